@@ -0,0 +1,12 @@
+#ifndef RANGE_REDUCTION_H
+#define RANGE_REDUCTION_H
+
+// Wrap any angle onto [0, 2*PI) in bounded time: unlike repeatedly adding or subtracting 2*PI, the time taken doesn't grow
+// with the size of the input. Moderate inputs (|radians| below 2^24) use a Cody-Waite reduction (2*PI split into several
+// constants so that "radians - k * 2*PI" is computed without cancellation error), which is only a few operations; huge inputs
+// use a Payne-Hanek reduction (multiplying the input's mantissa by only those bits of 1/(2*PI) that affect the fractional
+// number of turns), which takes longer but the same time for any of them. NaN and +/-Inf have no meaningful angle and are
+// mapped to 0.
+double reduceRadians_double(double radians);
+
+#endif // RANGE_REDUCTION_H
@@ -0,0 +1,106 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "range_reduction.h"
+
+// 2*PI to the full precision of a double. These are deliberately NOT the TWO_PI macro from sin_lut.h, which is built
+// from a float-precision PI and so is off from the true value by about 1.7e-7.
+//
+#define TWO_PI_DOUBLE			6.283185307179586232
+#define INV_TWO_PI_DOUBLE		0.159154943091895336
+
+// Cody-Waite constants: 2*PI = C1 + C2 + C3, where C1 and C2 have few enough significant bits (30) that "k * C1" and "k * C2"
+// are exact for every "k" below the limit. Above that limit the Payne-Hanek reduction is used instead.
+//
+#define CODY_WAITE_C1_DOUBLE	0x1.921fb54p+2
+#define CODY_WAITE_C2_DOUBLE	0x1.10b46118p-28
+#define CODY_WAITE_C3_DOUBLE	0x1.313198a2e037p-59
+#define CODY_WAITE_LIMIT_DOUBLE	16777216.0
+
+// The binary expansion of 1/(2*PI), most significant bits first, preceded by one word of zeros (the integer bits, with weights
+// 2^31 to 2^0). 1,280 fractional bits is enough to reduce any finite double.
+//
+static const uint32_t invTwoPi_bits[] =
+{
+	0x00000000,
+	0x28BE60DB, 0x9391054A, 0x7F09D5F4, 0x7D4D3770, 0x36D8A566, 0x4F10E410, 0x7F9458EA, 0xF7AEF158,
+	0x6DC91B8E, 0x909374B8, 0x01924BBA, 0x82746487, 0x3F877AC7, 0x2C4A69CF, 0xBA208D7D, 0x4BAED121,
+	0x3A671C09, 0xAD17DF90, 0x4E64758E, 0x60D4CE7D, 0x272117E2, 0xEF7E4A0E, 0xC7FE25FF, 0xF7816603,
+	0xFBCBC462, 0xD6829B47, 0xDB4D9FB3, 0xC9F2C26D, 0xD3D18FD9, 0xA797FA8B, 0x5D49EEB1, 0xFAF97C5E,
+	0xCF41CE7D, 0xE294A4BA, 0x9AFED7EC, 0x47E35742, 0x1580CC11, 0xBF1EDAEA, 0xFC33EF08, 0x26BD0D87
+};
+
+// Compute the fractional part of "mantissa * 2^exponent / (2*PI)" (i.e. how far around the circle the input lands) as an
+// unsigned 0.64 fixed-point number. Any bit of 1/(2*PI) whose weight, once multiplied by 2^exponent, is 2^0 or larger only adds
+// a whole number of turns, so we skip straight past those and multiply the mantissa by the next 128 bits. The bits after that
+// window change the result by less than 2^-75. Every loop has a fixed trip count, so the cost doesn't depend on the input.
+//
+static uint64_t fractionOfTurn(uint64_t mantissa, int exponent)
+{
+	int start = exponent + 32;
+	int word = start >> 5;
+	int shift = start & 31;
+	uint32_t window[4];
+	uint32_t a[2] = { (uint32_t)mantissa, (uint32_t)( mantissa >> 32 ) };
+	uint32_t product[4] = { 0 };
+
+	for( int idx = 0; idx < 4; idx++ )
+	{
+		uint64_t pair = ( (uint64_t)invTwoPi_bits[ word + idx ] << 32 ) | invTwoPi_bits[ word + idx + 1 ];
+		window[ 3 - idx ] = (uint32_t)( pair >> ( 32 - shift ) );
+	}
+
+	// Schoolbook multiplication, keeping only the low 128 bits of the product (the integer part of the result is the number of
+	// whole turns, which we don't care about).
+	//
+	for( int idx_a = 0; idx_a < 2; idx_a++ )
+	{
+		uint64_t carry = 0;
+		for( int idx_w = 0; ( idx_a + idx_w ) < 4; idx_w++ )
+		{
+			uint64_t partial = ( (uint64_t)a[ idx_a ] * window[ idx_w ] ) + product[ idx_a + idx_w ] + carry;
+			product[ idx_a + idx_w ] = (uint32_t)partial;
+			carry = partial >> 32;
+		}
+	}
+
+	return ( (uint64_t)product[3] << 32 ) | product[2];
+}
+
+static double payneHanek_double(double radians)
+{
+	uint64_t bits;
+	memcpy( &bits, &radians, sizeof( bits ) );
+
+	int biasedExponent = (int)( ( bits >> 52 ) & 0x7FF );
+	if( biasedExponent == 0x7FF ) return 0.0;
+
+	uint64_t mantissa = ( bits & 0x000FFFFFFFFFFFFFULL ) | ( 1ULL << 52 );
+	uint64_t fraction = fractionOfTurn( mantissa, biasedExponent - 1075 );
+	double ret = (double)( fraction >> 11 ) * 0x1p-53 * TWO_PI_DOUBLE;
+
+	return ( bits >> 63 ) ? ( TWO_PI_DOUBLE - ret ) : ret;
+}
+
+double reduceRadians_double(double radians)
+{
+	double ret;
+
+	if( fabs( radians ) < CODY_WAITE_LIMIT_DOUBLE )
+	{
+		// Truncating (instead of flooring) "k" leaves negative inputs one turn short; the correction below takes care of that
+		// as well as any rounding error in "radians * 1/(2*PI)".
+		//
+		double k = (double)( (int32_t)( radians * INV_TWO_PI_DOUBLE ) );
+		ret = ( ( radians - ( k * CODY_WAITE_C1_DOUBLE ) ) - ( k * CODY_WAITE_C2_DOUBLE ) ) - ( k * CODY_WAITE_C3_DOUBLE );
+	}
+	else ret = payneHanek_double( radians );
+
+	// Both reductions land within one turn of [0, 2*PI); these two selects (which compile to conditional moves, not branches)
+	// finish the job. The order matters: a tiny negative remainder plus 2*PI can round up to exactly 2*PI.
+	//
+	ret += ( ret < 0.0 ) ? TWO_PI_DOUBLE : 0.0;
+	ret -= ( ret >= TWO_PI_DOUBLE ) ? TWO_PI_DOUBLE : 0.0;
+
+	return ret;
+}
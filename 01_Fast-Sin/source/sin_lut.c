@@ -1,6 +1,7 @@
 #include <math.h>
 #include <stdio.h>
 #include "sin_lut.h"
+#include "range_reduction.h"
 
 #define SIN_LUT_SIZE 404
 
@@ -80,10 +81,9 @@ static const double sin_table[SIN_LUT_SIZE] =
 double sin_LUT(double radians)
 {
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
-	// to a valid  value instead of throwing an error.
+	// to a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
+	radians = reduceRadians_double( radians );
 	
 
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT). Round "radians" by adding 0.5 
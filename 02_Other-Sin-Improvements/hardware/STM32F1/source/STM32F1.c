@@ -107,6 +107,12 @@ errno_t initHardware(void)
   //
   SystemCoreClockUpdate();
 
+  // Start the DWT cycle counter, which readCycleCounter uses; it counts CPU clock cycles.
+  //
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
   /* USER CODE END 2 */
   return 0;
 
@@ -290,7 +296,70 @@ uint32_t systemTimeDiff_ns(p_systemTime_t p_startTime, p_systemTime_t p_endTime)
     return ( ( 1000000 * diff_ms ) + diff_ns );
 }
 
-void printResults_CUT(uint32_t iterations, sinLUT_implementation_t codeUnderTest[])
+uint64_t readCycleCounter(void)
+{
+    // The Cortex-M3 executes in order, so a barrier is all that's needed to keep the read from moving.
+    // NOTE: CYCCNT is only 32 bits, so it wraps after about 60 seconds at 72 MHz.
+    //
+    __DSB();
+    __ISB();
+    return DWT->CYCCNT;
+}
+
+double cycleCounterPeriod_ns(void)
+{
+    return 1000000000.0 / (double)SystemCoreClock;
+}
+
+// No RTOS, so no threads; one "thread" runs here, timed with the cycle counter (which limits it to about 60 seconds)
+//
+uint32_t availableCPUs(void)
+{
+    return 1;
+}
+
+errno_t runOnThreads(uint32_t threads, const threadWork_t * p_work, uint64_t * p_elapsed_ns)
+{
+    ASSERT( ( p_work != NULL ) && ( p_work->p_run != NULL ) );
+    ASSERT( p_elapsed_ns != NULL );
+
+    if( threads != 1 ) return -1;
+
+    if( p_work->p_setup != NULL ) p_work->p_setup( p_work->p_context, 0 );
+    uint32_t start = (uint32_t)readCycleCounter();
+    p_work->p_run( p_work->p_context, 0 );
+    *p_elapsed_ns = (uint64_t)( (double)( (uint32_t)readCycleCounter() - start ) * cycleCounterPeriod_ns() );
+    if( p_work->p_teardown != NULL ) p_work->p_teardown( p_work->p_context, 0 );
+
+    return 0;
+}
+
+// The Cortex-M3 has no data cache, so every read of a table already costs the same as the first
+//
+void evictFromCache(const void * p_start, size_t bytes)
+{
+}
+
+// The Cortex-M3 has no cache or branch predictor to miss in; its only event counter worth reporting here is the cycle counter.
+//
+static uint32_t perfCounters_startCycles;
+
+errno_t perfCounters_start(void)
+{
+    perfCounters_startCycles = (uint32_t)readCycleCounter();
+    return 0;
+}
+
+errno_t perfCounters_stop(perfCounts_t * p_counts)
+{
+    ASSERT(p_counts != NULL);
+
+    p_counts->count[PERF_CYCLES] = (uint32_t)readCycleCounter() - perfCounters_startCycles;
+    p_counts->valid = 1u << PERF_CYCLES;
+    return 0;
+}
+
+void printResults_CUT(uint32_t iterations, const char * p_inputs, sinLUT_implementation_t codeUnderTest[], outputFormat_t format)
 {
     while(1)
     {
@@ -298,4 +367,25 @@ void printResults_CUT(uint32_t iterations, sinLUT_implementation_t codeUnderTest
     }
 }
 
+// There's no file system to read a baseline from
+//
+int compareResults_baseline(const char * p_baselineFile, double threshold, sinLUT_implementation_t codeUnderTest[])
+{
+    return -1;
+}
+
+// There's no file system to read inputs from
+//
+errno_t readInputFile(const char * p_file, double ** pp_inputs, size_t * p_count)
+{
+    return -1;
+}
+
+// There's no regex library (and no command line to pass a pattern on), so every function is run
+//
+int functionName_matches(const char * name, const char * pattern)
+{
+    return 1;
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -14,6 +14,56 @@ errno_t getSystemTime(p_systemTime_t p_thisTime);
 errno_t elapsedSystemTime_ns(uint32_t * time_ns);
 uint32_t systemTimeDiff_ns(p_systemTime_t p_startTime, p_systemTime_t p_endTime);
 
-void printResults_CUT(uint32_t iterations, sinLUT_implementation_t codeUnderTest[]);
+// A free-running cycle counter, for timing blocks of calls too short to time with getSystemTime. Reading it is serialized, so
+// no instructions from before the read are still executing and none from after it have started. cycleCounterPeriod_ns is the
+// length of one count in ns, measured (or known) once by initHardware.
+uint64_t readCycleCounter(void);
+double cycleCounterPeriod_ns(void);
+
+// Evict "bytes" of memory starting at "p_start" from every level of data cache, and wait until that's done, so that the next
+// access to it has to go all the way to memory. Does nothing on targets without a data cache.
+void evictFromCache(const void * p_start, size_t bytes);
+
+// Count hardware events (cycles, instructions, branch misses, L1D misses and LLC misses) for the calling thread between
+// perfCounters_start and perfCounters_stop. Events the target can't count are left out of p_counts->valid rather than
+// treated as errors, so these always return 0 unless something actually went wrong.
+errno_t perfCounters_start(void);
+errno_t perfCounters_stop(perfCounts_t * p_counts);
+
+// Work to run on several threads at once (see runOnThreads). Each function is called on every thread with that thread's number
+// (0 to threads-1); "p_setup" and "p_teardown" (which may be NULL) run before and after the timed part, "p_run".
+typedef struct threadWork_t
+{
+	void (*p_setup)(void * p_context, uint32_t thread);
+	void (*p_run)(void * p_context, uint32_t thread);
+	void (*p_teardown)(void * p_context, uint32_t thread);
+	void * p_context;
+} threadWork_t;
+
+// The number of CPUs this process may run on; 1 on targets without threads
+uint32_t availableCPUs(void);
+
+// Run "p_work" on "threads" threads, thread N pinned to the Nth CPU this process may run on (wrapping around if there are
+// more threads than CPUs). Every thread finishes p_setup before any of them starts p_run; "p_elapsed_ns" is the time from
+// the first one starting p_run to the last one finishing it. Returns an error if the threads couldn't be started; targets
+// without threads can only run one, on the calling thread.
+errno_t runOnThreads(uint32_t threads, const threadWork_t * p_work, uint64_t * p_elapsed_ns);
+
+// "p_inputs" describes the inputs the functions were given (e.g. the distribution and seed)
+void printResults_CUT(uint32_t iterations, const char * p_inputs, sinLUT_implementation_t codeUnderTest[], outputFormat_t format);
+
+// Compare the results against a previous run saved with "--format=csv". An implementation has regressed if its median
+// per-call time or its max absolute error is more than "threshold" (e.g. 0.1 for 10%) worse than in the baseline; each one is
+// reported on stderr. Returns the number of regressions, or -1 if the baseline can't be read.
+int compareResults_baseline(const char * p_baselineFile, double threshold, sinLUT_implementation_t codeUnderTest[]);
+
+// Read a file of raw doubles (in this machine's byte order) into a newly allocated array, which the caller frees. Returns an
+// error if the file can't be read, is empty, or isn't a whole number of doubles.
+errno_t readInputFile(const char * p_file, double ** pp_inputs, size_t * p_count);
+
+// Returns 1 if "name" matches "pattern" (a POSIX extended regular expression, matched anywhere in the name, ignoring any
+// trailing whitespace), 0 if it doesn't, or -1 if "pattern" isn't a valid expression. Targets without a regex library match
+// every name.
+int functionName_matches(const char * name, const char * pattern);
 
 #endif // HARDWARE_H
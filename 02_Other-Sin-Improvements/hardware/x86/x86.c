@@ -2,10 +2,26 @@
 // Has to be at the begining of the file
 #define _GNU_SOURCE
 
+#include <ctype.h>
+#include <math.h>
+#include <pthread.h>
+#include <regex.h>
+#include <sched.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 #include "hardwareAPI.h"
 #include "assert.h"
 #include "error.h"
@@ -21,9 +37,322 @@ struct systemTime_t
 	struct timespec thisTime;
 };
 
+// How long initHardware watches the TSC to calibrate it
+//
+#define TSC_CALIBRATION_NS 50000000
+
+static double cyclePeriod_ns = 1.0;
+
+static uint64_t monotonic_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ( 1000000000ull * (uint64_t)now.tv_sec ) + (uint64_t)now.tv_nsec;
+}
+
+uint64_t readCycleCounter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	// RDTSC isn't serializing on its own; the LFENCE before it waits for everything earlier to finish and the one after it keeps
+	// anything later from starting until the TSC has been read.
+	//
+	_mm_lfence();
+	uint64_t ret = __rdtsc();
+	_mm_lfence();
+
+	return ret;
+#else
+	// No TSC on this host; count ns instead
+	//
+	return monotonic_ns();
+#endif
+}
+
+double cycleCounterPeriod_ns(void)
+{
+	return cyclePeriod_ns;
+}
+
+void evictFromCache(const void * p_start, size_t bytes)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	// CLFLUSH evicts one cache line from every level of the hierarchy (and from every core), and the MFENCE waits until all of
+	// them have been flushed. Flushing any address in a line flushes the whole line, so stepping by the smallest line size x86
+	// has ever had (64 bytes) and flushing the last byte as well covers every line the range touches.
+	//
+	const uint8_t * p_byte = (const uint8_t *)p_start;
+
+	if( bytes == 0 ) return;
+
+	for( size_t offset = 0; offset < bytes; offset += 64 ) _mm_clflush( p_byte + offset );
+	_mm_clflush( p_byte + bytes - 1 );
+	_mm_mfence();
+#else
+	// No portable way to do this on other hosts
+	//
+	(void)p_start;
+	(void)bytes;
+#endif
+}
+
+uint32_t availableCPUs(void)
+{
+	cpu_set_t cpus;
+
+	if( sched_getaffinity( 0, sizeof( cpus ), &cpus ) != 0 ) return 1;
+
+	return (uint32_t)CPU_COUNT( &cpus );
+}
+
+// Whether the threads runOnThreads has started may go ahead. They wait here until every one of them has been started (and
+// "start" set up for exactly that many), or until one couldn't be, in which case they all leave without running anything.
+//
+typedef enum launchState_t
+{
+	LAUNCH_WAITING,
+	LAUNCH_GO,
+	LAUNCH_CANCELLED
+} launchState_t;
+
+typedef struct launch_t
+{
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	launchState_t state;
+	pthread_barrier_t start;
+} launch_t;
+
+// What each thread started by runOnThreads needs. "p_launch->start" is a barrier for every thread plus the one that started
+// them, so that none of them starts p_run until they've all finished p_setup; each thread notes when it started and finished
+// p_run. (The thread that started them can't time them itself, since it may not get a CPU back until they're done.)
+//
+typedef struct threadArgs_t
+{
+	const threadWork_t * p_work;
+	uint32_t thread;
+	launch_t * p_launch;
+	uint64_t start_ns;
+	uint64_t finish_ns;
+} threadArgs_t;
+
+static void launch_set(launch_t * p_launch, launchState_t state)
+{
+	pthread_mutex_lock( &p_launch->lock );
+	p_launch->state = state;
+	pthread_cond_broadcast( &p_launch->changed );
+	pthread_mutex_unlock( &p_launch->lock );
+}
+
+static void * runThread(void * p_arg)
+{
+	threadArgs_t * p_args = (threadArgs_t *)p_arg;
+	const threadWork_t * p_work = p_args->p_work;
+	launch_t * p_launch = p_args->p_launch;
+
+	pthread_mutex_lock( &p_launch->lock );
+	while( p_launch->state == LAUNCH_WAITING ) pthread_cond_wait( &p_launch->changed, &p_launch->lock );
+	launchState_t state = p_launch->state;
+	pthread_mutex_unlock( &p_launch->lock );
+
+	if( state == LAUNCH_CANCELLED ) return NULL;
+
+	if( p_work->p_setup != NULL ) p_work->p_setup( p_work->p_context, p_args->thread );
+	pthread_barrier_wait( &p_launch->start );
+	p_args->start_ns = monotonic_ns();
+	p_work->p_run( p_work->p_context, p_args->thread );
+	p_args->finish_ns = monotonic_ns();
+	if( p_work->p_teardown != NULL ) p_work->p_teardown( p_work->p_context, p_args->thread );
+
+	return NULL;
+}
+
+errno_t runOnThreads(uint32_t threads, const threadWork_t * p_work, uint64_t * p_elapsed_ns)
+{
+	cpu_set_t allowed;
+	launch_t launch = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, LAUNCH_WAITING };
+	uint32_t started = 0;
+
+	ASSERT( threads > 0 );
+	ASSERT( ( p_work != NULL ) && ( p_work->p_run != NULL ) );
+	ASSERT( p_elapsed_ns != NULL );
+
+	if( sched_getaffinity( 0, sizeof( allowed ), &allowed ) != 0 ) return -1;
+
+	pthread_t * p_threads = (pthread_t *)malloc( threads * sizeof( pthread_t ) );
+	threadArgs_t * p_args = (threadArgs_t *)malloc( threads * sizeof( threadArgs_t ) );
+	if( ( p_threads == NULL ) || ( p_args == NULL ) )
+	{
+		free( p_threads );
+		free( p_args );
+		return -1;
+	}
+
+	// Pin thread N to the Nth allowed CPU
+	//
+	int cpu = -1;
+	for( ; started < threads; started++ )
+	{
+		pthread_attr_t attributes;
+		cpu_set_t pinned;
+
+		do cpu = ( cpu + 1 ) % CPU_SETSIZE; while( !CPU_ISSET( cpu, &allowed ) );
+		CPU_ZERO( &pinned );
+		CPU_SET( cpu, &pinned );
+
+		p_args[started].p_work = p_work;
+		p_args[started].thread = started;
+		p_args[started].p_launch = &launch;
+		p_args[started].start_ns = 0;
+		p_args[started].finish_ns = 0;
+
+		pthread_attr_init( &attributes );
+		pthread_attr_setaffinity_np( &attributes, sizeof( pinned ), &pinned );
+		int failed = pthread_create( &p_threads[started], &attributes, runThread, &p_args[started] );
+		pthread_attr_destroy( &attributes );
+		if( failed ) break;
+	}
+
+	// The barrier is only set up once every thread has been started, since it can't be taken back down to the number that
+	// did start. If one couldn't be (or the barrier can't be set up), the ones that did are sent home before doing anything.
+	//
+	if( ( started < threads ) || ( pthread_barrier_init( &launch.start, NULL, threads + 1 ) != 0 ) )
+	{
+		launch_set( &launch, LAUNCH_CANCELLED );
+		for( uint32_t thread = 0; thread < started; thread++ ) pthread_join( p_threads[thread], NULL );
+		free( p_threads );
+		free( p_args );
+		return -1;
+	}
+
+	launch_set( &launch, LAUNCH_GO );
+	pthread_barrier_wait( &launch.start );
+
+	uint64_t start_ns = UINT64_MAX;
+	uint64_t finish_ns = 0;
+
+	for( uint32_t thread = 0; thread < started; thread++ )
+	{
+		pthread_join( p_threads[thread], NULL );
+		if( p_args[thread].start_ns < start_ns ) start_ns = p_args[thread].start_ns;
+		if( p_args[thread].finish_ns > finish_ns ) finish_ns = p_args[thread].finish_ns;
+	}
+
+	*p_elapsed_ns = finish_ns - start_ns;
+
+	pthread_barrier_destroy( &launch.start );
+	free( p_threads );
+	free( p_args );
+
+	return 0;
+}
+
+#if defined(__linux__)
+// One perf_event_open file descriptor per perfCounter_t, or -1 if the kernel won't count that event for us (e.g. under a VM
+// that doesn't expose the PMU, or if /proc/sys/kernel/perf_event_paranoid is too strict). The events are opened separately
+// rather than as a group so that one missing event doesn't take the others with it.
+//
+static int perfFds[NUM_PERF_COUNTERS] = { -1, -1, -1, -1, -1 };
+
+#define CACHE_READ_MISS(cache) ( (cache) | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) )
+
+static void perfCounters_open(void)
+{
+	const struct { uint32_t type; uint64_t config; } events[NUM_PERF_COUNTERS] =
+	{
+		[PERF_CYCLES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		[PERF_INSTRUCTIONS] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		[PERF_BRANCH_MISSES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		[PERF_L1D_MISSES] = { PERF_TYPE_HW_CACHE, CACHE_READ_MISS( PERF_COUNT_HW_CACHE_L1D ) },
+		[PERF_LLC_MISSES] = { PERF_TYPE_HW_CACHE, CACHE_READ_MISS( PERF_COUNT_HW_CACHE_LL ) }
+	};
+
+	for( int idx = 0; idx < NUM_PERF_COUNTERS; idx++ )
+	{
+		struct perf_event_attr attr = {0};
+		attr.size = sizeof( attr );
+		attr.type = events[idx].type;
+		attr.config = events[idx].config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		// This thread, any CPU
+		//
+		perfFds[idx] = (int)syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 );
+	}
+}
+#endif
+
+errno_t perfCounters_start(void)
+{
+#if defined(__linux__)
+	for( int idx = 0; idx < NUM_PERF_COUNTERS; idx++ )
+	{
+		if( perfFds[idx] < 0 ) continue;
+		ioctl( perfFds[idx], PERF_EVENT_IOC_RESET, 0 );
+		ioctl( perfFds[idx], PERF_EVENT_IOC_ENABLE, 0 );
+	}
+#endif
+
+	return 0;
+}
+
+errno_t perfCounters_stop(perfCounts_t * p_counts)
+{
+	ASSERT( p_counts != NULL );
+
+	p_counts->valid = 0;
+
+#if defined(__linux__)
+	for( int idx = 0; idx < NUM_PERF_COUNTERS; idx++ )
+	{
+		if( perfFds[idx] < 0 ) continue;
+		ioctl( perfFds[idx], PERF_EVENT_IOC_DISABLE, 0 );
+	}
+
+	for( int idx = 0; idx < NUM_PERF_COUNTERS; idx++ )
+	{
+		uint64_t values[3];		// value, time enabled, time running
+
+		if( perfFds[idx] < 0 ) continue;
+		if( read( perfFds[idx], values, sizeof( values ) ) != sizeof( values ) ) continue;
+		if( values[2] == 0 ) continue;
+
+		// If there are more events than hardware counters, the kernel takes turns counting them; scale the count up to the
+		// whole time the event was enabled.
+		//
+		p_counts->count[idx] = ( values[2] < values[1] ) ? (uint64_t)( (double)values[0] * values[1] / values[2] ) : values[0];
+		p_counts->valid |= 1u << idx;
+	}
+#endif
+
+	return 0;
+}
+
 errno_t initHardware(void)
 {
-	//No initialization required for x86
+#if defined(__x86_64__) || defined(__i386__)
+	// The TSC runs at a constant rate on any recent x86 CPU (regardless of the actual clock speed), but that rate isn't
+	// reported anywhere portable, so count how many ticks go by in a known amount of time.
+	//
+	uint64_t start_ns = monotonic_ns();
+	uint64_t start_ticks = readCycleCounter();
+	uint64_t end_ns;
+
+	do
+	{
+		end_ns = monotonic_ns();
+	} while( ( end_ns - start_ns ) < TSC_CALIBRATION_NS );
+
+	uint64_t end_ticks = readCycleCounter();
+	cyclePeriod_ns = (double)( end_ns - start_ns ) / (double)( end_ticks - start_ticks );
+#endif
+
+#if defined(__linux__)
+	perfCounters_open();
+#endif
+
 	return 0;
 }
 
@@ -73,21 +402,449 @@ uint32_t systemTimeDiff_ns(p_systemTime_t p_startTime, p_systemTime_t p_endTime)
 	return ( ( 1000000000 * diff_sec ) + diff_ns );
 }
 
-void printResults_CUT(uint32_t iterations, sinLUT_implementation_t codeUnderTest[])
+static void printResults_table(uint32_t iterations, const char * p_inputs, sinLUT_implementation_t codeUnderTest[])
 {
 	printf("-----Sin LUT Test-----\n");
-	printf("Number of iterations: %d\n\n", iterations);
-	printf("Function\tAvg Exec Time (ns)\tMax Abs Err\tAvg Abs Err\tAvg Pcnt Err\n");
-	printf("------------------------------------------------------------------------------------\n");
+	printf("Number of iterations: %d\n", iterations);
+	printf("Inputs: %s\n", p_inputs);
+	printf("Array LUT kernel: %s\n", sin_LUT_kernelName( sin_LUT_selectedKernel() ));
+	printf("Cycle counter period: %f ns\n\n", cycleCounterPeriod_ns());
+	printf("Function\tAvg Exec Time (ns)\tThroughput (ns)\tLatency (ns)\tMax Abs Err\tAvg Abs Err\tAvg Pcnt Err\tMemory (B)\n");
+	printf("------------------------------------------------------------------------------------------------------------------------------------\n");
 
 	int idx_CUT = 0;
 	while( codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED )
 	{
-		printf("%s\t%f\t\t%1.12f\t%1.12f\t%1.12f\n", codeUnderTest[idx_CUT].fcn_name, 
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported )
+		{
+			printf("%s\tnot supported by this CPU\n", codeUnderTest[idx_CUT].fcn_name);
+			idx_CUT++;
+			continue;
+		}
+
+		printf("%s\t%f\t\t%f\t%f\t%1.12f\t%1.12f\t%1.12f\t%zu\n", codeUnderTest[idx_CUT].fcn_name, 
 			codeUnderTest[idx_CUT].executionTime_ns_avg, 
+			codeUnderTest[idx_CUT].throughput_ns, 
+			codeUnderTest[idx_CUT].latency_ns, 
 			codeUnderTest[idx_CUT].absoluteError_max,
 			codeUnderTest[idx_CUT].absoluteError_avg,
-			codeUnderTest[idx_CUT].percentError_avg);
+			codeUnderTest[idx_CUT].percentError_avg,
+			codeUnderTest[idx_CUT].memoryBytes);
 		idx_CUT++;
 	}
-}
\ No newline at end of file
+
+	for( idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported ) continue;
+
+		if( codeUnderTest[idx_CUT].absoluteError_max > codeUnderTest[idx_CUT].errorBound )
+		{
+			printf("WARNING: %s max abs error %g is over its declared bound of %g\n", codeUnderTest[idx_CUT].fcn_name,
+				codeUnderTest[idx_CUT].absoluteError_max, codeUnderTest[idx_CUT].errorBound);
+		}
+	}
+
+	printf("\nPer-call execution time (ns): percentiles over all samples; mean, stddev and 95%% confidence interval after\n");
+	printf("trimming the slowest samples\n\n");
+	printf("Function\tMin\tMedian\tp90\tp99\tp99.9\tMax\tMean\tStddev\t95%% CI (+/-)\tSamples kept\n");
+	printf("------------------------------------------------------------------------------------------------------------------------------\n");
+
+	for( idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		const timingStats_t * p_stats = &codeUnderTest[idx_CUT].executionTime_stats;
+
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported ) continue;
+
+		printf("%s\t%.1f\t%.1f\t%.1f\t%.1f\t%.1f\t%.1f\t%.1f\t%.1f\t%.2f\t\t%u/%u\n", codeUnderTest[idx_CUT].fcn_name,
+			p_stats->min, p_stats->median, p_stats->p90, p_stats->p99, p_stats->p999, p_stats->max,
+			p_stats->mean, p_stats->stddev, p_stats->ci95, p_stats->samples_trimmed, p_stats->samples);
+	}
+
+	printf("\nHardware counters during the throughput run (per look-up, except IPC); \"n/a\" if this machine can't count it\n\n");
+	printf("Function\tIPC\tCycles\tInstr\tBr Miss\tL1D Miss\tLLC Miss\n");
+	printf("------------------------------------------------------------------------------------\n");
+
+	for( idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		const perfCounts_t * p_counts = &codeUnderTest[idx_CUT].perfCounts;
+		double lookups = (double)p_counts->lookups;
+		uint32_t has_ipc = ( 1u << PERF_CYCLES ) | ( 1u << PERF_INSTRUCTIONS );
+
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported ) continue;
+
+		printf("%s\t", codeUnderTest[idx_CUT].fcn_name);
+
+		if( ( ( p_counts->valid & has_ipc ) == has_ipc ) && ( p_counts->count[PERF_CYCLES] > 0 ) )
+		{
+			printf("%.2f\t", (double)p_counts->count[PERF_INSTRUCTIONS] / (double)p_counts->count[PERF_CYCLES]);
+		}
+		else printf("n/a\t");
+
+		for( int counter = 0; counter < NUM_PERF_COUNTERS; counter++ )
+		{
+			if( ( p_counts->valid & ( 1u << counter ) ) && ( lookups > 0 ) ) printf("%.4f\t", (double)p_counts->count[counter] / lookups);
+			else printf("n/a\t");
+			if( counter == PERF_L1D_MISSES ) printf("\t");
+		}
+
+		printf("\n");
+	}
+
+	// Only if the cold-cache timings were asked for
+	//
+	int coldCache = 0;
+	for( idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		if( !isnan( codeUnderTest[idx_CUT].coldCall_ns ) ) coldCache = 1;
+	}
+
+	if( !coldCache ) return;
+
+	printf("\nSingle calls (median ns per input, with each function's tables in cache and evicted from it before every call)\n\n");
+	printf("Function\tWarm\tCold\tCold-Warm\tMemory (B)\n");
+	printf("------------------------------------------------------------\n");
+
+	for( idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		const sinLUT_implementation_t * p_CUT = &codeUnderTest[idx_CUT];
+
+		if( p_CUT->function_enum == fcn_unsupported ) continue;
+
+		printf("%s\t%.1f\t%.1f\t%.1f\t\t%zu\n", p_CUT->fcn_name, p_CUT->warmCall_ns, p_CUT->coldCall_ns,
+			p_CUT->coldCall_ns - p_CUT->warmCall_ns, p_CUT->memoryBytes);
+	}
+}
+
+// The machine-readable formats below share one list of columns, so that a CSV and a JSON file from the same run hold the same
+// data and a CSV can be read back in as a baseline. Names are trimmed of the trailing tabs some of them carry to line up the
+// table.
+//
+#ifndef BUILD_TYPE
+#define BUILD_TYPE "unknown"
+#endif
+#ifndef BUILD_FLAGS
+#define BUILD_FLAGS "unknown"
+#endif
+
+#define MAX_NAME_LENGTH 64
+
+static void trimmedName(const char * name, char * buffer)
+{
+	size_t length = strlen( name );
+
+	if( length >= MAX_NAME_LENGTH ) length = MAX_NAME_LENGTH - 1;
+	while( ( length > 0 ) && isspace( (unsigned char)name[length-1] ) ) length--;
+	memcpy( buffer, name, length );
+	buffer[length] = '\0';
+}
+
+static void cpuModel(char * buffer, size_t size)
+{
+	snprintf( buffer, size, "unknown" );
+
+#if defined(__x86_64__) || defined(__i386__)
+	// The brand string is 48 bytes spread over 3 CPUID leaves, 16 bytes (EAX, EBX, ECX, EDX) each
+	//
+	uint32_t brand[13] = {0};
+	if( __get_cpuid_max( 0x80000000, NULL ) >= 0x80000004 )
+	{
+		for( uint32_t leaf = 0; leaf < 3; leaf++ )
+		{
+			__get_cpuid( 0x80000002 + leaf, &brand[4*leaf], &brand[4*leaf+1], &brand[4*leaf+2], &brand[4*leaf+3] );
+		}
+
+		const char * model = (const char *)brand;
+		while( *model == ' ' ) model++;
+		snprintf( buffer, size, "%s", model );
+	}
+#endif
+}
+
+// A counter that wasn't counted (or any other value that isn't finite) is printed as an empty CSV field or a JSON null
+//
+static double perfCountPerLookup(const perfCounts_t * p_counts, perfCounter_t counter)
+{
+	if( !( p_counts->valid & ( 1u << counter ) ) || ( p_counts->lookups == 0 ) ) return NAN;
+
+	return (double)p_counts->count[counter] / (double)p_counts->lookups;
+}
+
+static double perfIPC(const perfCounts_t * p_counts)
+{
+	uint32_t needed = ( 1u << PERF_CYCLES ) | ( 1u << PERF_INSTRUCTIONS );
+
+	if( ( ( p_counts->valid & needed ) != needed ) || ( p_counts->count[PERF_CYCLES] == 0 ) ) return NAN;
+
+	return (double)p_counts->count[PERF_INSTRUCTIONS] / (double)p_counts->count[PERF_CYCLES];
+}
+
+#define NUM_METRICS 24
+
+static const char * metricNames[NUM_METRICS] =
+{
+	"mean_ns", "min_ns", "median_ns", "p90_ns", "p99_ns", "p999_ns", "max_ns", "trimmed_mean_ns", "stddev_ns", "ci95_ns",
+	"throughput_ns", "latency_ns", "max_abs_err", "avg_abs_err", "avg_pct_err",
+	"ipc", "branch_misses", "l1d_misses", "llc_misses", "cycles", "error_bound", "memory_bytes",
+	"warm_call_ns", "cold_call_ns"
+};
+
+static void metrics(const sinLUT_implementation_t * p_CUT, double * values)
+{
+	const timingStats_t * p_stats = &p_CUT->executionTime_stats;
+	const double all[NUM_METRICS] =
+	{
+		p_CUT->executionTime_ns_avg, p_stats->min, p_stats->median, p_stats->p90, p_stats->p99, p_stats->p999, p_stats->max,
+		p_stats->mean, p_stats->stddev, p_stats->ci95,
+		p_CUT->throughput_ns, p_CUT->latency_ns, p_CUT->absoluteError_max, p_CUT->absoluteError_avg, p_CUT->percentError_avg,
+		perfIPC( &p_CUT->perfCounts ), perfCountPerLookup( &p_CUT->perfCounts, PERF_BRANCH_MISSES ),
+		perfCountPerLookup( &p_CUT->perfCounts, PERF_L1D_MISSES ), perfCountPerLookup( &p_CUT->perfCounts, PERF_LLC_MISSES ),
+		perfCountPerLookup( &p_CUT->perfCounts, PERF_CYCLES ), p_CUT->errorBound, (double)p_CUT->memoryBytes,
+		p_CUT->warmCall_ns, p_CUT->coldCall_ns
+	};
+
+	memcpy( values, all, sizeof( all ) );
+}
+
+static void printResults_csv(uint32_t iterations, const char * p_inputs, sinLUT_implementation_t codeUnderTest[])
+{
+	char cpu[64];
+	char name[MAX_NAME_LENGTH];
+	double values[NUM_METRICS];
+	sinLUT_tableSizes_t tables = sin_LUT_tableSizes();
+
+	// The run's settings go in comment lines, which the baseline reader skips
+	//
+	cpuModel( cpu, sizeof( cpu ) );
+	printf("# build=%s flags=%s compiler=%s\n", BUILD_TYPE, BUILD_FLAGS, __VERSION__);
+	printf("# cpu=%s kernel=%s iterations=%u\n", cpu, sin_LUT_kernelName( sin_LUT_selectedKernel() ), iterations);
+	printf("# inputs=%s\n", p_inputs);
+	printf("# table_entries uniform=%zu quarter_wave=%zu non_uniform=%zu\n", tables.uniform, tables.quarterWave, tables.nonUniform);
+
+	printf("function");
+	for( int metric = 0; metric < NUM_METRICS; metric++ ) printf(",%s", metricNames[metric]);
+	printf("\n");
+
+	for( int idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported ) continue;
+
+		trimmedName( codeUnderTest[idx_CUT].fcn_name, name );
+		metrics( &codeUnderTest[idx_CUT], values );
+
+		printf("\"%s\"", name);
+		for( int metric = 0; metric < NUM_METRICS; metric++ )
+		{
+			if( !isfinite( values[metric] ) ) printf(",");
+			else printf(",%.17g", values[metric]);
+		}
+		printf("\n");
+	}
+}
+
+static void printResults_json(uint32_t iterations, const char * p_inputs, sinLUT_implementation_t codeUnderTest[])
+{
+	char cpu[64];
+	char name[MAX_NAME_LENGTH];
+	double values[NUM_METRICS];
+	sinLUT_tableSizes_t tables = sin_LUT_tableSizes();
+	const char * separator = "";
+
+	cpuModel( cpu, sizeof( cpu ) );
+	printf("{\n");
+	printf("  \"build\": { \"type\": \"%s\", \"flags\": \"%s\", \"compiler\": \"%s\" },\n", BUILD_TYPE, BUILD_FLAGS, __VERSION__);
+	printf("  \"cpu\": \"%s\",\n", cpu);
+	printf("  \"array_kernel\": \"%s\",\n", sin_LUT_kernelName( sin_LUT_selectedKernel() ));
+	printf("  \"iterations\": %u,\n", iterations);
+	printf("  \"inputs\": \"%s\",\n", p_inputs);
+	printf("  \"table_entries\": { \"uniform\": %zu, \"quarter_wave\": %zu, \"non_uniform\": %zu },\n",
+		tables.uniform, tables.quarterWave, tables.nonUniform);
+	printf("  \"results\": [");
+
+	for( int idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported ) continue;
+
+		trimmedName( codeUnderTest[idx_CUT].fcn_name, name );
+		metrics( &codeUnderTest[idx_CUT], values );
+
+		printf("%s\n    { \"function\": \"%s\"", separator, name);
+		for( int metric = 0; metric < NUM_METRICS; metric++ )
+		{
+			if( !isfinite( values[metric] ) ) printf(", \"%s\": null", metricNames[metric]);
+			else printf(", \"%s\": %.17g", metricNames[metric], values[metric]);
+		}
+		printf(" }");
+		separator = ",";
+	}
+
+	printf("\n  ]\n}\n");
+}
+
+void printResults_CUT(uint32_t iterations, const char * p_inputs, sinLUT_implementation_t codeUnderTest[], outputFormat_t format)
+{
+	switch( format )
+	{
+		case OUTPUT_CSV: printResults_csv( iterations, p_inputs, codeUnderTest ); break;
+		case OUTPUT_JSON: printResults_json( iterations, p_inputs, codeUnderTest ); break;
+		default: printResults_table( iterations, p_inputs, codeUnderTest ); break;
+	}
+}
+
+// Return the index of "column" in a CSV header line, or -1 if it isn't there
+//
+static int csvColumn(const char * header, const char * column)
+{
+	int idx = 0;
+	size_t length = strlen( column );
+
+	for( const char * field = header; field != NULL; idx++ )
+	{
+		if( ( strncmp( field, column, length ) == 0 ) && ( ( field[length] == ',' ) || ( field[length] == '\n' ) ||
+			( field[length] == '\r' ) || ( field[length] == '\0' ) ) ) return idx;
+
+		field = strchr( field, ',' );
+		if( field != NULL ) field++;
+	}
+
+	return -1;
+}
+
+// Copy field "column" of a CSV line into "buffer", without quotes
+//
+static void csvField(const char * line, int column, char * buffer, size_t size)
+{
+	const char * field = line;
+	size_t length = 0;
+
+	for( int idx = 0; ( idx < column ) && ( field != NULL ); idx++ )
+	{
+		field = strchr( field, ',' );
+		if( field != NULL ) field++;
+	}
+
+	if( field != NULL )
+	{
+		if( *field == '"' ) field++;
+		while( ( field[length] != ',' ) && ( field[length] != '"' ) && ( field[length] != '\n' ) && ( field[length] != '\r' ) &&
+			( field[length] != '\0' ) ) length++;
+	}
+
+	if( length >= size ) length = size - 1;
+	if( length > 0 ) memcpy( buffer, field, length );
+	buffer[length] = '\0';
+}
+
+int compareResults_baseline(const char * p_baselineFile, double threshold, sinLUT_implementation_t codeUnderTest[])
+{
+	char line[1024];
+	char name[MAX_NAME_LENGTH];
+	char field[MAX_NAME_LENGTH];
+	int column_name = -1, column_median = -1, column_error = -1;
+	int regressions = 0;
+
+	ASSERT( p_baselineFile != NULL );
+
+	FILE * p_file = fopen( p_baselineFile, "r" );
+	if( p_file == NULL ) return -1;
+
+	while( fgets( line, sizeof( line ), p_file ) != NULL )
+	{
+		if( line[0] == '#' ) continue;
+
+		if( column_name < 0 )
+		{
+			column_name = csvColumn( line, "function" );
+			column_median = csvColumn( line, "median_ns" );
+			column_error = csvColumn( line, "max_abs_err" );
+			if( ( column_name < 0 ) || ( column_median < 0 ) || ( column_error < 0 ) ) break;
+			continue;
+		}
+
+		csvField( line, column_name, name, sizeof( name ) );
+
+		for( int idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+		{
+			char current[MAX_NAME_LENGTH];
+			sinLUT_implementation_t * p_CUT = &codeUnderTest[idx_CUT];
+
+			trimmedName( p_CUT->fcn_name, current );
+			if( ( p_CUT->function_enum == fcn_unsupported ) || ( strcmp( current, name ) != 0 ) ) continue;
+
+			csvField( line, column_median, field, sizeof( field ) );
+			double baseline_median = strtod( field, NULL );
+			csvField( line, column_error, field, sizeof( field ) );
+			double baseline_error = strtod( field, NULL );
+
+			if( p_CUT->executionTime_stats.median > baseline_median * ( 1.0 + threshold ) )
+			{
+				fprintf(stderr, "REGRESSION: %s median time %.1f ns vs %.1f ns in baseline\n", current,
+					p_CUT->executionTime_stats.median, baseline_median);
+				regressions++;
+			}
+
+			if( p_CUT->absoluteError_max > baseline_error * ( 1.0 + threshold ) )
+			{
+				fprintf(stderr, "REGRESSION: %s max abs error %.3g vs %.3g in baseline\n", current,
+					p_CUT->absoluteError_max, baseline_error);
+				regressions++;
+			}
+		}
+	}
+
+	fclose( p_file );
+
+	return ( column_error < 0 ) ? -1 : regressions;
+}
+
+errno_t readInputFile(const char * p_file, double ** pp_inputs, size_t * p_count)
+{
+	ASSERT( p_file != NULL );
+	ASSERT( pp_inputs != NULL );
+	ASSERT( p_count != NULL );
+
+	FILE * p_stream = fopen( p_file, "rb" );
+	if( p_stream == NULL ) return -1;
+
+	long size = -1;
+	if( fseek( p_stream, 0, SEEK_END ) == 0 ) size = ftell( p_stream );
+	rewind( p_stream );
+
+	if( ( size <= 0 ) || ( ( size % (long)sizeof( double ) ) != 0 ) )
+	{
+		fclose( p_stream );
+		return -1;
+	}
+
+	size_t count = (size_t)size / sizeof( double );
+	double * p_inputs = (double *)malloc( (size_t)size );
+
+	if( ( p_inputs == NULL ) || ( fread( p_inputs, sizeof( double ), count, p_stream ) != count ) )
+	{
+		free( p_inputs );
+		fclose( p_stream );
+		return -1;
+	}
+
+	fclose( p_stream );
+	*pp_inputs = p_inputs;
+	*p_count = count;
+
+	return 0;
+}
+
+int functionName_matches(const char * name, const char * pattern)
+{
+	char trimmed[MAX_NAME_LENGTH];
+	regex_t regex;
+
+	ASSERT( name != NULL );
+	ASSERT( pattern != NULL );
+
+	if( regcomp( &regex, pattern, REG_EXTENDED | REG_NOSUB ) != 0 ) return -1;
+
+	trimmedName( name, trimmed );
+	int ret = ( regexec( &regex, trimmed, 0, NULL, 0 ) == 0 );
+	regfree( &regex );
+
+	return ret;
+}
@@ -0,0 +1,57 @@
+#ifndef ACCURACY_H
+#define ACCURACY_H
+
+#include <stdint.h>
+#include "main.h"
+#include "error.h"
+
+// An accuracy sweep measures a function's error over a whole domain instead of at a thousand random inputs, so that the
+// worst case is actually found (and comes out the same every run). Float functions are given every float in the domain.
+// There are far too many doubles for that, so double functions are given one random input from each of "samples" equal
+// slices of the domain (stratified sampling, so that no part of the domain is missed). Fixed-point functions are given every
+// q9.22 in the domain if there are no more than "samples" of them, and are sampled the same way otherwise. The work is spread
+// across "threads" threads (see range_splitter.h).
+//
+// Errors are measured against referenceSin (see reference.h), both in absolute terms and in ULPs of the function's output type (the
+// spacing between adjacent floats or doubles at the correct answer, or 2^-31 for a q0.31). Near 0 an ULP is tiny, so a LUT's
+// ULP error there is huge; that's real, since it's the relative error that's large there.
+//
+typedef struct accuracyConfig_t
+{
+	double domain_min;		// The inputs are in [domain_min, domain_max)
+	double domain_max;
+	uint64_t samples;
+	uint64_t seed;
+	uint32_t threads;
+} accuracyConfig_t;
+
+// Enough samples for a slice of [0, 2*PI) to be narrower than a fifth of the finest table's step
+//
+#define ACCURACY_DEFAULT_SAMPLES ( 1u << 24 )
+
+// Bin 0 of the histogram counts errors under 0.5 ULP, bin 1 those from 0.5 up to 1 ULP and each bin after that the errors
+// from the last bin's limit up to twice that, except that the last bin counts everything from its lower limit up.
+//
+#define ACCURACY_HISTOGRAM_BINS 64
+
+typedef struct accuracyResult_t
+{
+	uint64_t inputs;
+	int exhaustive;					// Set if the function was given every input in the domain
+	double absoluteError_max;
+	double absoluteError_argmax;	// The input with the largest error (the smallest, if several tie)
+	double ulpError_max;
+	double ulpError_argmax;
+	double absoluteError_avg;
+	uint64_t histogram[ACCURACY_HISTOGRAM_BINS];
+	uint64_t elapsed_ns;
+} accuracyResult_t;
+
+// Sweep one function. Scaffolding and unsupported functions can't be swept. Returns an error if the threads couldn't be
+// started (or there wasn't enough memory).
+errno_t accuracy_sweep(const sinLUT_implementation_t * p_CUT, const accuracyConfig_t * p_config, accuracyResult_t * p_result);
+
+// The upper limit of a histogram bin, in ULPs (INFINITY for the last one)
+double accuracyHistogram_binLimit(int bin);
+
+#endif // ACCURACY_H
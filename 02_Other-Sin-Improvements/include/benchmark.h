@@ -0,0 +1,18 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Compiler barriers for the test harness, so that it can be built with optimizations on without the compiler removing (or
+// hoisting out of the timed region) the very calls it's trying to time. Neither one emits any instructions; they only
+// constrain what the compiler is allowed to assume.
+//
+//  - DO_NOT_OPTIMIZE( value ) tells the compiler that "value" is read by something it can't see, so it has to be computed,
+//    and computed before this point. Used on the inputs, it also stops the compiler from treating them as known values.
+//  - CLOBBER_MEMORY() tells the compiler that any memory may have been read or written, so every store before it has to
+//    actually happen (e.g. the outputs of an array LUT) and nothing can be loaded early from after it.
+//
+// Both use GCC's extended asm, which ARM GCC supports as well.
+//
+#define DO_NOT_OPTIMIZE(value) __asm__ volatile( "" : "+g"( value ) : : "memory" )
+#define CLOBBER_MEMORY() __asm__ volatile( "" : : : "memory" )
+
+#endif // BENCHMARK_H
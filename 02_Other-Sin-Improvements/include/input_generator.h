@@ -0,0 +1,67 @@
+#ifndef INPUT_GENERATOR_H
+#define INPUT_GENERATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Inputs for the test harness. Uniformly random inputs are the worst case for the caches and branch predictors but the best
+// case for everything else, so there are several distributions to choose from:
+//
+//  - INPUT_UNIFORM: uniform over [0, 2*PI)
+//  - INPUT_SWEEP: a phase that goes up by a small fixed step each time, wrapping at 2*PI (e.g. an oscillator)
+//  - INPUT_RANDOM_WALK: each input a small random step from the last one, wrapping at 0 and 2*PI (e.g. a noisy sensor)
+//  - INPUT_GAUSSIAN: clustered around a few operating points (normally distributed around each, chosen at random)
+//  - INPUT_LARGE: far outside [0, 2*PI): magnitudes spread evenly on a log scale from 2*PI up to INPUT_LARGE_MAX, either sign
+//  - INPUT_ADVERSARIAL: within a few ULPs of the points where the LUTs move on to their next entry or segment (see
+//    sin_LUT_boundary), where they're least accurate
+//  - INPUT_REPLAY: read from a file (recorded from a real system), in order and starting over at the end
+//
+// Everything random comes from a xorshift64* generator, which is fast, has no hidden state and gives the same sequence on
+// every target for the same seed.
+//
+typedef enum inputDistribution_t
+{
+	INPUT_UNIFORM,
+	INPUT_SWEEP,
+	INPUT_RANDOM_WALK,
+	INPUT_GAUSSIAN,
+	INPUT_LARGE,
+	INPUT_ADVERSARIAL,
+	INPUT_REPLAY,
+	NUM_INPUT_DISTRIBUTIONS
+} inputDistribution_t;
+
+#define INPUT_LARGE_MAX 1.0e6
+
+typedef struct inputGenerator_t * p_inputGenerator_t;
+
+// Create a generator. "p_replay" and "replay_size" are only used by INPUT_REPLAY (which needs at least one input) and must stay
+// around for as long as the generator does. Returns NULL if out of memory.
+p_inputGenerator_t inputGenerator_create(inputDistribution_t distribution, uint64_t seed, const double * p_replay, size_t replay_size);
+void inputGenerator_destroy(p_inputGenerator_t this);
+
+// Go back to the start of the sequence, so that every function under test can be given the same inputs
+void inputGenerator_reset(p_inputGenerator_t this);
+
+// The next input, or the next "n" inputs
+double inputGenerator_next(p_inputGenerator_t this);
+void inputGenerator_fill(p_inputGenerator_t this, double * p_inputs, size_t n);
+
+// The name of each distribution (as given on the command line), and the distribution with a given name. inputDistribution_find
+// returns 0 if there is one.
+const char * inputDistribution_name(inputDistribution_t distribution);
+int inputDistribution_find(const char * name, inputDistribution_t * p_distribution);
+
+// The xorshift64* generator on its own. The state must never be 0; xorshift_seed takes care of that.
+typedef struct xorshift_t
+{
+	uint64_t state;
+} xorshift_t;
+
+void xorshift_seed(xorshift_t * p_rng, uint64_t seed);
+uint64_t xorshift_next(xorshift_t * p_rng);
+
+// Uniform in [0, 1), with all 53 bits of a double random
+double xorshift_uniform(xorshift_t * p_rng);
+
+#endif // INPUT_GENERATOR_H
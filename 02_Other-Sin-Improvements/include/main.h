@@ -2,15 +2,44 @@
 #define MAIN_H
 
 #include "sin_lut.h"
+#include "sin_lut_registry.h"
+#include "statistics.h"
 
-typedef enum fcnSignature_t
+// How the block timing feeds inputs to the function being timed: independent inputs (so the CPU can overlap as many calls as
+// it likes; this measures throughput) or a chain where each output feeds into the next input (so each call has to finish
+// before the next one can start; this measures latency).
+typedef enum benchmarkMode_t
 {
-	NOT_ASSIGNED,
-	fcn_scaffolding,
-	fcn_dbl_in_dbl_out,
-	fcn_flt_in_flt_out,
-	fcn_fxd_in_fxd_out
-} fcnSignature_t;
+	BENCHMARK_THROUGHPUT,
+	BENCHMARK_LATENCY
+} benchmarkMode_t;
+
+// How printResults_CUT formats the results: a human-readable table, or every metric as CSV or JSON
+typedef enum outputFormat_t
+{
+	OUTPUT_TABLE,
+	OUTPUT_CSV,
+	OUTPUT_JSON
+} outputFormat_t;
+
+// Hardware performance counters, read around the throughput run of each function (see perfCounters_start/_stop in
+// hardwareAPI.h). Not every target or OS can count every event; bit N of "valid" is set if count[N] was actually counted.
+typedef enum perfCounter_t
+{
+	PERF_CYCLES,
+	PERF_INSTRUCTIONS,
+	PERF_BRANCH_MISSES,
+	PERF_L1D_MISSES,
+	PERF_LLC_MISSES,
+	NUM_PERF_COUNTERS
+} perfCounter_t;
+
+typedef struct perfCounts_t
+{
+	uint64_t count[NUM_PERF_COUNTERS];
+	uint32_t valid;
+	uint64_t lookups;		// Number of sin look-ups made while counting, to normalize the counts by
+} perfCounts_t;
 
 typedef struct sinLUT_implementation_t
 {
@@ -21,6 +50,9 @@ typedef struct sinLUT_implementation_t
 		p_sin_LUT_double fcn_double;
 		p_sin_LUT_float fcn_float;
 		p_sin_LUT_fixedPoint fcn_fixedPoint;
+		p_sin_LUT_double_batch fcn_double_batch;
+		p_sin_LUT_float_batch fcn_float_batch;
+		p_sin_LUT_fixedPoint_batch fcn_fixedPoint_batch;
 	};
 	double executionTime_ns;
 	double executionTime_ns_avg;
@@ -29,6 +61,16 @@ typedef struct sinLUT_implementation_t
 	double absoluteError_max;
 	double percentError_sum;
 	double percentError_avg;
+	sinLUT_kernel_t kernel;
+	double throughput_ns;
+	double latency_ns;
+	timingStats_t executionTime_stats;
+	perfCounts_t perfCounts;
+	double errorBound;
+	size_t memoryBytes;
+	sinLUT_table_t tables[SIN_LUT_MAX_TABLES];
+	double warmCall_ns;
+	double coldCall_ns;
 } sinLUT_implementation_t;
 
 #endif // MAIN_H
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef NONUNIFORM_LUT_H
+#define NONUNIFORM_LUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A non-uniform LUT of any size: a sorted list of knots {x, y}, linearly interpolated between. Unlike the 25-element sin LUTs
+// in sin_lut.c (which are small enough to index by bucket), these are meant for tables with hundreds or thousands of knots,
+// where finding the right segment is the expensive part. There are three ways to search:
+//
+//  - NONUNIFORM_SEARCH_BINARY: the classic "while( low <= high )" binary search, kept as a baseline. It exits as soon as it
+//    finds the segment, but every comparison is a branch the CPU has to guess.
+//  - NONUNIFORM_SEARCH_BRANCHLESS: a binary search whose trip count depends only on the table size (ceil(log2(size))), with each
+//    step compiled to a conditional move. Nothing to mispredict, but every step still waits on the previous load.
+//  - NONUNIFORM_SEARCH_EYTZINGER: the knots are stored in breadth-first (Eytzinger) order, so the next few levels of the search
+//    are contiguous and can be prefetched while the current level is compared. Best once the table no longer fits in L1.
+//
+typedef enum nonUniformSearch_t
+{
+	NONUNIFORM_SEARCH_BINARY,
+	NONUNIFORM_SEARCH_BRANCHLESS,
+	NONUNIFORM_SEARCH_EYTZINGER
+} nonUniformSearch_t;
+
+typedef struct nonUniformLUT_double_t * p_nonUniformLUT_double_t;
+
+// Copy "size" knots (at least 2, with strictly increasing x-values) into a new LUT that uses the given search. Returns NULL if
+// out of memory. Inputs below the first knot or above the last one are extrapolated from the first or last segment.
+p_nonUniformLUT_double_t nonUniformLUT_double_create(const double * x, const double * y, size_t size, nonUniformSearch_t search);
+void nonUniformLUT_double_destroy(p_nonUniformLUT_double_t this);
+
+// Evaluate the LUT at "x" using the search it was created with
+double nonUniformLUT_double(p_nonUniformLUT_double_t this, double x);
+
+// Evaluate the LUT at each element of "in"; "in" and "out" must not overlap
+void nonUniformLUT_double_batch(p_nonUniformLUT_double_t this, const double * restrict in, double * restrict out, size_t n);
+
+// Return the index of the segment containing "key" (the last knot with x <= key, or 0 if there isn't one) in a sorted list of
+// "size" x-values, with a fixed number of branch-free steps. Defined here so that, when "size" is a compile-time constant, the
+// compiler can fully unroll the loop.
+static inline size_t nonUniform_searchBranchless_double(const double * x, size_t size, double key)
+{
+	const double * base = x;
+
+	while( size > 1 )
+	{
+		size_t half = size / 2;
+		base = ( base[half] <= key ) ? ( base + half ) : base;
+		size -= half;
+	}
+
+	return (size_t)( base - x );
+}
+
+#endif // NONUNIFORM_LUT_H
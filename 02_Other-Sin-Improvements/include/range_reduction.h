@@ -0,0 +1,102 @@
+#ifndef RANGE_REDUCTION_H
+#define RANGE_REDUCTION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "fixed_point.h"
+
+// 2*PI to the full precision of each data type. These are deliberately NOT the TWO_PI macro from sin_lut.h, which is built
+// from a float-precision PI and so is off from the true value by about 1.7e-7.
+//
+#define TWO_PI_DOUBLE			6.283185307179586232
+#define INV_TWO_PI_DOUBLE		0.159154943091895336
+#define TWO_PI_FLOAT			6.2831853f
+#define INV_TWO_PI_FLOAT		0.15915494f
+
+// Cody-Waite constants: 2*PI = C1 + C2 + C3, where C1 and C2 have few enough significant bits (30 for double, 12 for float)
+// that "k * C1" and "k * C2" are exact for every "k" below the corresponding limit. Above that limit the Payne-Hanek
+// reduction is used instead.
+//
+#define CODY_WAITE_C1_DOUBLE	0x1.921fb54p+2
+#define CODY_WAITE_C2_DOUBLE	0x1.10b46118p-28
+#define CODY_WAITE_C3_DOUBLE	0x1.313198a2e037p-59
+#define CODY_WAITE_LIMIT_DOUBLE	16777216.0
+
+#define CODY_WAITE_C1_FLOAT		0x1.92p+2f
+#define CODY_WAITE_C2_FLOAT		0x1.fb4p-10f
+#define CODY_WAITE_C3_FLOAT		0x1.4442d2p-22f
+#define CODY_WAITE_LIMIT_FLOAT	16384.0f
+
+// 2*PI in q3.28 (one more integer bit than needed, to leave head room for the corrections below), 2*PI in q9.22, and 1/(2*PI)
+// in q0.32 (which is too wide for TOFIX).
+//
+#define TWO_PI_Q28				TOFIX( TWO_PI_DOUBLE, 28 )
+#define TWO_PI_Q22				TOFIX( TWO_PI_DOUBLE, 22 )
+#define INV_TWO_PI_Q32			683565276LL
+
+// Wrap any angle onto [0, 2*PI) in bounded time: unlike repeatedly adding or subtracting 2*PI, the time taken doesn't grow
+// with the size of the input. Moderate inputs (|radians| below 2^24 for a double, 2^14 for a float) use a Cody-Waite
+// reduction (2*PI split into several constants so that "radians - k * 2*PI" is computed without cancellation error), which
+// is only a few operations; huge inputs use a Payne-Hanek reduction (multiplying the input's mantissa by only those bits of
+// 1/(2*PI) that affect the fractional number of turns), which takes longer but the same time for any of them. NaN and
+// +/-Inf have no meaningful angle and are mapped to 0.
+double reduceRadians_double(double radians);
+float reduceRadians_float(float radians);
+
+// Check whether every element of an array is below the Cody-Waite limit, so that a batch of inputs can be reduced with the
+// inline functions below. Returns 0 if any element is too large or isn't finite.
+int radiansAreModerate_double(const double * radians, size_t n);
+int radiansAreModerate_float(const float * radians, size_t n);
+
+// The Cody-Waite half of reduceRadians_double/_float. Only valid for |radians| < CODY_WAITE_LIMIT_X; it's defined here so that it
+// can be inlined into loops.
+static inline double reduceRadians_double_codyWaite(double radians)
+{
+	// Truncating (instead of flooring) "k" leaves negative inputs one turn short; the correction below takes care of that as
+	// well as any rounding error in "radians * 1/(2*PI)".
+	//
+	double k = (double)( (int32_t)( radians * INV_TWO_PI_DOUBLE ) );
+	double ret = ( ( radians - ( k * CODY_WAITE_C1_DOUBLE ) ) - ( k * CODY_WAITE_C2_DOUBLE ) ) - ( k * CODY_WAITE_C3_DOUBLE );
+
+	// The result is within one turn of [0, 2*PI); these two selects (which compile to conditional moves, not branches) finish
+	// the job. The order matters: a tiny negative remainder plus 2*PI can round up to exactly 2*PI.
+	//
+	ret += ( ret < 0.0 ) ? TWO_PI_DOUBLE : 0.0;
+	ret -= ( ret >= TWO_PI_DOUBLE ) ? TWO_PI_DOUBLE : 0.0;
+
+	return ret;
+}
+
+static inline float reduceRadians_float_codyWaite(float radians)
+{
+	float k = (float)( (int32_t)( radians * INV_TWO_PI_FLOAT ) );
+	float ret = ( ( radians - ( k * CODY_WAITE_C1_FLOAT ) ) - ( k * CODY_WAITE_C2_FLOAT ) ) - ( k * CODY_WAITE_C3_FLOAT );
+
+	ret += ( ret < 0.0f ) ? TWO_PI_FLOAT : 0.0f;
+	ret -= ( ret >= TWO_PI_FLOAT ) ? TWO_PI_FLOAT : 0.0f;
+
+	return ret;
+}
+
+static inline q9_22_t reduceRadians_fixedPoint(q9_22_t radians)
+{
+	// Every q9.22 value is within 82 turns of 0, so a single multiply by 1/(2*PI) gives "k" (floored, since the shift is
+	// arithmetic) and the remainder is computed in 64 bits at q28 to avoid compounding the rounding error in 2*PI. Neither step
+	// can overflow, so the "_safe" LUTs can use this as-is.
+	//
+	int64_t k = ( (int64_t)radians * INV_TWO_PI_Q32 ) >> ( 22 + 32 );
+	int64_t remainder = ( (int64_t)radians * 64 ) - ( k * TWO_PI_Q28 );
+
+	remainder += ( remainder < 0 ) ? TWO_PI_Q28 : 0;
+	remainder -= ( remainder >= TWO_PI_Q28 ) ? TWO_PI_Q28 : 0;
+
+	// Truncating back to q22 can land exactly on 2*PI's q22 value, which is the x-value of the last element of the non-uniform
+	// LUTs.
+	//
+	q9_22_t ret = (q9_22_t)FCONV( remainder, 28, 22 );
+	ret -= ( ret >= TWO_PI_Q22 ) ? TWO_PI_Q22 : 0;
+
+	return ret;
+}
+
+#endif // RANGE_REDUCTION_H
@@ -0,0 +1,21 @@
+#ifndef RANGE_SPLITTER_H
+#define RANGE_SPLITTER_H
+
+#include <stdint.h>
+
+// Hands out the indices [begin, end) to several workers (threads), a chunk at a time, with work stealing: each worker starts
+// with an equal share and takes chunks from the front of it, and a worker that runs out takes the back half of what another
+// worker has left. So a worker that's slower than the others (or started late, or shares its CPU) doesn't hold them all up,
+// without the workers having to agree on anything more than once per chunk.
+//
+typedef struct rangeSplitter_t * p_rangeSplitter_t;
+
+// Returns NULL if out of memory. "chunk" (the most handed out at once) has to be at least 1.
+p_rangeSplitter_t rangeSplitter_create(uint64_t begin, uint64_t end, uint32_t workers, uint64_t chunk);
+void rangeSplitter_destroy(p_rangeSplitter_t this);
+
+// The next indices for worker "worker" (0 to workers-1) to work on, [*p_begin, *p_end). Returns 0 once there are none left.
+// Every index is handed out exactly once, to one worker.
+int rangeSplitter_next(p_rangeSplitter_t this, uint32_t worker, uint64_t * p_begin, uint64_t * p_end);
+
+#endif // RANGE_SPLITTER_H
@@ -0,0 +1,34 @@
+#ifndef REFERENCE_H
+#define REFERENCE_H
+
+#include <stddef.h>
+
+// The "correct" answer each function's error is measured against. The C library's sin (REFERENCE_DOUBLE) is accurate to
+// about an ULP of a double, which is plenty for the LUTs but leaves little headroom for the best polynomials (whose errors
+// then partly measure the reference). REFERENCE_LONG_DOUBLE uses sinl (a 64-bit significand on x86, but the same as a double
+// on targets where long double is a double) and REFERENCE_FLOAT128 uses libquadmath's sinq (113 bits; only where the build
+// has libquadmath, see HAVE_QUADMATH in the Makefile). The answers come back as long doubles, so that the errors can be
+// worked out without rounding them to a double first.
+//
+typedef enum referenceOracle_t
+{
+	REFERENCE_DOUBLE,
+	REFERENCE_LONG_DOUBLE,
+	REFERENCE_FLOAT128,
+	NUM_REFERENCE_ORACLES
+} referenceOracle_t;
+
+// Whether this build can use an oracle, and which one referenceSin uses (REFERENCE_DOUBLE until another is selected). Returns
+// an error if "oracle" isn't supported.
+int referenceOracle_supported(referenceOracle_t oracle);
+int referenceOracle_select(referenceOracle_t oracle);
+
+// sin( radians ), from the selected oracle
+long double referenceSin(double radians);
+
+// The name of each oracle (as given on the command line), and the oracle with a given name. referenceOracle_find returns 0 if
+// there is one.
+const char * referenceOracle_name(referenceOracle_t oracle);
+int referenceOracle_find(const char * name, referenceOracle_t * p_oracle);
+
+#endif // REFERENCE_H
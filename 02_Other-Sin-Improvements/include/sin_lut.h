@@ -1,6 +1,7 @@
 #ifndef SIN_LUT_H
 #define SIN_LUT_H
 
+#include <stddef.h>
 #include "fixed_point.h"
 
 #define PI 3.14159265358979000f
@@ -9,8 +10,43 @@
 typedef double (*p_sin_LUT_double)(double);
 typedef float (*p_sin_LUT_float)(float);
 typedef q0_31_t (*p_sin_LUT_fixedPoint)(q9_22_t);
+typedef void (*p_sin_LUT_double_batch)(const double * restrict, double * restrict, size_t);
+typedef void (*p_sin_LUT_float_batch)(const float * restrict, float * restrict, size_t);
+typedef void (*p_sin_LUT_fixedPoint_batch)(const q9_22_t * restrict, q0_31_t * restrict, size_t);
 
-// Populate sin LUTs
+// The instruction sets that the interpolated array LUTs have been hand-vectorized for, from slowest to fastest.
+typedef enum sinLUT_kernel_t
+{
+	SIN_LUT_KERNEL_SCALAR,
+	SIN_LUT_KERNEL_SSE41,
+	SIN_LUT_KERNEL_AVX2,
+	SIN_LUT_KERNEL_AVX512
+} sinLUT_kernel_t;
+
+// What the uniform LUTs (the ones at steps of 1/64) store. SIN_LUT_VALUES_EXACT stores sin at each step. With
+// SIN_LUT_VALUES_MINIMAX, the interpolated LUTs' nodes are moved off the curve by half of the straight line's sag, which halves
+// their largest error (the same error as a table with 1.4 times as many entries), and the rounded LUTs instead return the
+// midrange of sin over the inputs that round to each entry. The rounded LUTs' error comes almost entirely from sin's slope
+// across an entry, though, which no choice of value can do anything about, so they only gain where sin is flattest (and they
+// no longer return exactly 0 for an input of 0). The quarter-wave and non-uniform LUTs always store exact values.
+typedef enum sinLUT_values_t
+{
+	SIN_LUT_VALUES_EXACT,
+	SIN_LUT_VALUES_MINIMAX,
+	NUM_SIN_LUT_VALUES
+} sinLUT_values_t;
+
+// Pick the values init_sinLUT fills the uniform LUTs with (SIN_LUT_VALUES_EXACT until another is selected), so this has to be
+// called before init_sinLUT. Returns an error if "values" isn't one of the above.
+int sin_LUT_selectValues(sinLUT_values_t values);
+sinLUT_values_t sin_LUT_selectedValues(void);
+
+// The name of each kind of values (as given on the command line), and the kind with a given name. sin_LUT_findValues returns
+// 0 if there is one.
+const char * sin_LUT_valuesName(sinLUT_values_t values);
+int sin_LUT_findValues(const char * name, sinLUT_values_t * p_values);
+
+// Populate sin LUTs and pick the fastest array kernels this CPU supports
 void init_sinLUT(void);
 
 // Default sin LUT implementation
@@ -31,4 +67,93 @@ q0_31_t sin_LUT_fixedPoint_interpolate(q9_22_t radians);
 q0_31_t sin_LUT_fixedPoint_nonUniform(q9_22_t radians);
 q0_31_t sin_LUT_fixedPoint_nonUniform_safe(q9_22_t radians);
 
+// Same as the "_interpolate" LUTs, but using a table of {y0, slope} pairs, so each call does one load and no subtraction
+double sin_LUT_double_interpolate_interleaved(double radians);
+float sin_LUT_float_interpolate_interleaved(float radians);
+q0_31_t sin_LUT_fixedPoint_interpolate_interleaved(q9_22_t radians);
+
+// Same as sin_LUT_X and sin_LUT_X_interpolate, but storing only the first quarter of the sine wave and rebuilding the rest by
+// symmetry, so the tables are a quarter of the size for the same resolution
+double sin_LUT_double_quarter(double radians);
+float sin_LUT_float_quarter(float radians);
+q0_31_t sin_LUT_fixedPoint_quarter(q9_22_t radians);
+double sin_LUT_double_quarter_interpolate(double radians);
+float sin_LUT_float_quarter_interpolate(float radians);
+q0_31_t sin_LUT_fixedPoint_quarter_interpolate(q9_22_t radians);
+
+// Same as sin_LUT_float_nonUniform, but finding the segment by comparing the input against every knot (a branch-free linear scan
+// of a struct-of-arrays copy of the table) instead of by bucket
+float sin_LUT_float_nonUniform_scan(float radians);
+
+// Array versions of the LUTs above: "out[idx] = sin_LUT_X( in[idx] )" for every idx in [0, n), without a function call per
+// element, so the table address and scale factors are loaded once and the compiler can vectorize whatever the target allows.
+// "in" and "out" must not overlap. (The "_safe" LUTs stop on the first overflow, so they don't have array versions.)
+void sin_LUT_double_batch(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_batch(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_fixedPoint_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n);
+void sin_LUT_double_interpolate_batch(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_batch(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_fixedPoint_interpolate_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n);
+void sin_LUT_double_nonUniform_batch(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_nonUniform_batch(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_fixedPoint_nonUniform_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n);
+void sin_LUT_double_interpolate_interleaved_batch(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_interleaved_batch(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_fixedPoint_interpolate_interleaved_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n);
+void sin_LUT_float_nonUniform_scan_batch(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_double_quarter_interpolate_batch(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_quarter_interpolate_batch(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_fixedPoint_quarter_interpolate_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n);
+
+// The interpolated array LUTs, reading "table" instead of the built-in table, so that a caller can give each thread (or NUMA
+// node) its own copy. "table" has to hold the same values as the built-in one (sin_LUT_X_table(), which has
+// sin_LUT_tableSizes().uniform entries and is filled in by init_sinLUT).
+void sin_LUT_double_interpolate_batch_table(const double * restrict table, const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_batch_table(const float * restrict table, const float * restrict in, float * restrict out, size_t n);
+const double * sin_LUT_double_table(void);
+const float * sin_LUT_float_table(void);
+
+// The interpolated array LUTs, vectorized with the best instruction set the CPU supports. init_sinLUT checks the CPU once and
+// points these at the matching kernel (until then they use the portable versions), so the same binary runs on any x86 host.
+void sin_LUT_double_interpolate_batch_best(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_batch_best(const float * restrict in, float * restrict out, size_t n);
+
+// Which kernel init_sinLUT chose, whether a given kernel can run on this CPU, and a printable name for each kernel.
+sinLUT_kernel_t sin_LUT_selectedKernel(void);
+int sin_LUT_kernelSupported(sinLUT_kernel_t kernel);
+const char * sin_LUT_kernelName(sinLUT_kernel_t kernel);
+
+// Number of entries in each kind of table (every data type of a given kind has the same number), for reporting
+typedef struct sinLUT_tableSizes_t
+{
+	size_t uniform;
+	size_t quarterWave;
+	size_t nonUniform;
+} sinLUT_tableSizes_t;
+
+sinLUT_tableSizes_t sin_LUT_tableSizes(void);
+
+// Every input in [0, 2*PI] at which one of the LUTs above moves on to the next table entry or segment, for testing them where
+// they're least accurate (idx < sin_LUT_boundaryCount(); the boundaries aren't in order)
+size_t sin_LUT_boundaryCount(void);
+double sin_LUT_boundary(size_t idx);
+
+#if defined(__x86_64__) || defined(__i386__)
+// Hand-vectorized versions of the interpolated array LUTs (in sin_lut_x86.c). The "_avx512" functions require a CPU with
+// AVX-512F, the "_avx2" functions require AVX2 and FMA, and the "_sse41" functions require SSE4.1; use
+// sin_LUT_kernelSupported to check before calling one directly. Their results match the portable versions above to within a
+// rounding error.
+void sin_LUT_double_interpolate_batch_avx512(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_batch_avx512(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_double_interpolate_batch_avx2(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_batch_avx2(const float * restrict in, float * restrict out, size_t n);
+void sin_LUT_double_interpolate_batch_sse41(const double * restrict in, double * restrict out, size_t n);
+void sin_LUT_float_interpolate_batch_sse41(const float * restrict in, float * restrict out, size_t n);
+
+// AVX2 versions of the linear-scan non-uniform LUT. Both require AVX2 (check sin_LUT_kernelSupported( SIN_LUT_KERNEL_AVX2 ));
+// the scalar one compares one input against 8 knots per instruction, the array one compares 8 inputs against one knot.
+float sin_LUT_float_nonUniform_scan_avx2(float radians);
+void sin_LUT_float_nonUniform_scan_batch_avx2(const float * restrict in, float * restrict out, size_t n);
+#endif
+
 #endif // SIN_LUT_H
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef SIN_LUT_REGISTRY_H
+#define SIN_LUT_REGISTRY_H
+
+#include <stddef.h>
+#include "sin_lut.h"
+
+// The kinds of function the test harness knows how to call. NOT_ASSIGNED ends a list of functions and fcn_unsupported marks
+// one this CPU can't run; neither is ever registered.
+typedef enum fcnSignature_t
+{
+	NOT_ASSIGNED,
+	fcn_scaffolding,
+	fcn_dbl_in_dbl_out,
+	fcn_flt_in_flt_out,
+	fcn_fxd_in_fxd_out,
+	fcn_dbl_arr_dbl_arr,
+	fcn_flt_arr_flt_arr,
+	fcn_fxd_arr_fxd_arr,
+	fcn_unsupported
+} fcnSignature_t;
+
+// Whether functions with this signature take an array of inputs (and so are called with BATCH_SIZE of them at a time)
+static inline int fcnSignature_isBatch(fcnSignature_t signature)
+{
+	return ( signature == fcn_dbl_arr_dbl_arr ) || ( signature == fcn_flt_arr_flt_arr ) || ( signature == fcn_fxd_arr_fxd_arr );
+}
+
+// A table a sin function reads, listed with SIN_LUT_TABLE( name ) (which works for arrays and structs alike)
+typedef struct sinLUT_table_t
+{
+	const void * p_start;
+	size_t bytes;
+} sinLUT_table_t;
+
+#define SIN_LUT_TABLE(table) { &( table ), sizeof( table ) }
+#define SIN_LUT_MAX_TABLES 2
+
+// Everything the test harness needs to know about one sin function. "errorBound" is the largest absolute error the function
+// should make for any input in [0, 2*PI) (the harness flags it if it measures more), and "tables" are the tables it reads
+// (unused entries are left as {NULL, 0}), so that the harness can report their size and evict them from the cache.
+typedef struct sinLUT_registration_t
+{
+	const char * name;
+	fcnSignature_t signature;
+	union
+	{
+		p_sin_LUT_double fcn_double;
+		p_sin_LUT_float fcn_float;
+		p_sin_LUT_fixedPoint fcn_fixedPoint;
+		p_sin_LUT_double_batch fcn_double_batch;
+		p_sin_LUT_float_batch fcn_float_batch;
+		p_sin_LUT_fixedPoint_batch fcn_fixedPoint_batch;
+	};
+	sinLUT_kernel_t kernel;
+	double errorBound;
+	sinLUT_table_t tables[SIN_LUT_MAX_TABLES];
+} sinLUT_registration_t;
+
+#define SIN_LUT_MAX_REGISTRATIONS 128
+
+// Add "count" functions to the registry. The array is kept by reference, so it has to stay around (i.e. be static).
+void sinLUT_register(const sinLUT_registration_t * p_registrations, size_t count);
+
+// The registered functions, in the order they were registered (idx < sinLUT_registeredCount())
+size_t sinLUT_registeredCount(void);
+const sinLUT_registration_t * sinLUT_registered(size_t idx);
+
+// The total size of the tables a function reads
+size_t sinLUT_memoryBytes(const sinLUT_registration_t * p_registration);
+
+// Each source file registers its own functions by listing them in a static array and passing the array to this macro, which
+// registers them before main() runs. Files run their registrations in link order, so the harness reports them in the order
+// the files appear in SRC_FILES (and, within a file, in the order they're listed).
+#define SIN_LUT_REGISTER(registrations)											\
+	__attribute__((constructor)) static void register_##registrations(void)		\
+	{																			\
+		sinLUT_register( registrations, sizeof( registrations ) / sizeof( registrations[0] ) );	\
+	}
+
+#endif // SIN_LUT_REGISTRY_H
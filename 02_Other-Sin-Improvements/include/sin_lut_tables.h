@@ -0,0 +1,66 @@
+#ifndef SIN_LUT_TABLES_H
+#define SIN_LUT_TABLES_H
+
+#include "fixed_point.h"
+
+#define SIN_LUT_SIZE 404
+
+// The uniform sin LUTs (at integer steps of "radians * 64"), filled in by init_sinLUT. They're shared with the target-specific
+// kernels (e.g. the SIMD versions in sin_lut_x86.c), which is the only reason they aren't static to sin_lut.c; nothing else
+// should include this file.
+extern double sinTable_double[SIN_LUT_SIZE];
+extern float sinTable_float[SIN_LUT_SIZE];
+extern q0_31_t sinTable_fixedPoint[SIN_LUT_SIZE];
+
+// The same tables, interleaved as {y0, slope} pairs (slope being the next table value minus this one), so that interpolating
+// takes one load instead of two dependent ones and no subtraction. Each pair is aligned to its own size and each table to a
+// cache line, so a pair never straddles two cache lines. The last pair's slope is never used and is 0.
+typedef struct pair_double_t
+{
+	_Alignas( 16 ) double y0;
+	double slope;
+} pair_double_t;
+
+typedef struct pair_float_t
+{
+	_Alignas( 8 ) float y0;
+	float slope;
+} pair_float_t;
+
+typedef struct pair_fixed_t
+{
+	_Alignas( 8 ) q0_31_t y0;
+	q0_31_t slope;
+} pair_fixed_t;
+
+#define CACHE_LINE_SIZE 64
+
+extern pair_double_t sinPairs_double[SIN_LUT_SIZE];
+extern pair_float_t sinPairs_float[SIN_LUT_SIZE];
+extern pair_fixed_t sinPairs_fixedPoint[SIN_LUT_SIZE];
+
+// A struct-of-arrays copy of the float non-uniform LUT (the original is an array of {x0, y0, slope} records, which can't be
+// loaded into a vector), for look-ups that compare an input against every x-value at once. It's padded out to a whole number of
+// 256-bit vectors with x-values of +Inf, which no input is ever >=.
+#define NONUNIFORM_0DOT007ERROR_SIZE 25
+#define NONUNIFORM_SCAN_SIZE 32
+
+typedef struct nonUniformScan_float_t
+{
+	_Alignas( CACHE_LINE_SIZE ) float x0[NONUNIFORM_SCAN_SIZE];
+	float y0[NONUNIFORM_SCAN_SIZE];
+	float slope[NONUNIFORM_SCAN_SIZE];
+} nonUniformScan_float_t;
+
+extern nonUniformScan_float_t nonUniformScan_float_0dot007error;
+
+// Error bounds for registering the LUTs (see sin_lut_registry.h): half a step for the rounded LUTs and step^2/8 (the most a
+// straight line can be off from a curve whose second derivative is at most 1) for the interpolated ones, plus a little for the
+// float and fixed-point rounding. The non-uniform tables were generated for a maximum error of 0.007.
+#define UNIFORM_LUT_STEP ( 1.0 / 64.0 )
+#define ROUNDING_ERROR_MARGIN 1e-6
+#define ROUNDED_ERROR_BOUND(step) ( ( (step) / 2.0 ) + ROUNDING_ERROR_MARGIN )
+#define INTERPOLATED_ERROR_BOUND(step) ( ( (step) * (step) / 8.0 ) + ROUNDING_ERROR_MARGIN )
+#define NONUNIFORM_0DOT007ERROR_BOUND ( 0.007 + ROUNDING_ERROR_MARGIN )
+
+#endif // SIN_LUT_TABLES_H
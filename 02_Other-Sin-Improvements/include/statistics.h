@@ -0,0 +1,29 @@
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <stdint.h>
+
+// Summary of a set of timing samples. The percentiles, min and max are taken from every sample, so the tail stays visible; the
+// mean, standard deviation and confidence interval are taken after trimming the slowest samples (see timingStats_compute),
+// so one page fault or context switch can't drag them around.
+typedef struct timingStats_t
+{
+	uint32_t samples;			// Number of samples, before trimming
+	uint32_t samples_trimmed;	// Number of samples the mean, stddev and confidence interval are based on
+	double min;
+	double median;
+	double p90;
+	double p99;
+	double p999;
+	double max;
+	double mean;
+	double stddev;
+	double ci95;				// Half-width of the 95% confidence interval of the mean: the mean is "mean +/- ci95"
+} timingStats_t;
+
+// Sort "samples" (in place) and summarize them in "stats". "trimFraction" (0 to less than 1) is the fraction of the slowest
+// samples to leave out of the mean, stddev and confidence interval; timing noise only ever makes a sample slower, so only the
+// top is trimmed. Two functions whose means are closer than the sum of their "ci95"s are statistically tied.
+void timingStats_compute(uint32_t * samples, uint32_t n, double trimFraction, timingStats_t * stats);
+
+#endif // STATISTICS_H
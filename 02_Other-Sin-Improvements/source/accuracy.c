@@ -0,0 +1,399 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "accuracy.h"
+#include "range_splitter.h"
+#include "input_generator.h"
+#include "reference.h"
+#include "hardwareAPI.h"
+#include "fixed_point.h"
+#include "assert.h"
+
+// How many inputs a thread takes from the splitter at once (enough that the lock is never contended), and how many inputs at
+// a time the array LUTs are given
+//
+#define ACCURACY_CHUNK ( 1u << 16 )
+#define ACCURACY_BATCH 256
+
+// The sizes of an ULP: the number of bits in a float's and a double's significand (counting the hidden bit), the smallest
+// exponent of a normal number (below which the ULP stays the same), and the size of a q0.31's one fixed step
+//
+#define FLOAT_PRECISION 24
+#define FLOAT_MIN_EXPONENT -126
+#define DOUBLE_PRECISION 53
+#define DOUBLE_MIN_EXPONENT -1022
+#define Q0_31_ULP 0x1.0p-31
+
+// q9.22 inputs go from -512 up to (but not including) 512
+//
+#define Q9_22_MIN_CODE INT32_MIN
+#define Q9_22_END_CODE ( (int64_t)INT32_MAX + 1 )
+
+// How the domain maps onto the indices handed out by the range splitter
+//
+typedef enum sweepKind_t
+{
+	SWEEP_EVERY_FLOAT,		// Index N is the float whose ordered key (see floatKey) is N
+	SWEEP_STRATIFIED,		// Index N is a random input from the Nth of "indices" equal slices of the domain
+	SWEEP_EVERY_CODE,		// Index N is the q9.22 code N + code_begin
+	SWEEP_STRATIFIED_CODE	// Index N is a random code from the Nth of "indices" equal slices of the codes in the domain
+} sweepKind_t;
+
+typedef struct sweepAccumulator_t
+{
+	uint64_t inputs;
+	double absoluteError_sum;
+	double absoluteError_max;
+	double absoluteError_argmax;
+	double ulpError_max;
+	double ulpError_argmax;
+	uint64_t histogram[ACCURACY_HISTOGRAM_BINS];
+} sweepAccumulator_t;
+
+typedef struct sweepWork_t
+{
+	const sinLUT_implementation_t * p_CUT;
+	const accuracyConfig_t * p_config;
+	sweepKind_t kind;
+	uint64_t indices;
+	int64_t code_begin;
+	uint64_t codes;
+	p_rangeSplitter_t p_splitter;
+	sweepAccumulator_t * p_accumulators;	// One per thread
+} sweepWork_t;
+
+// Floats, as integers that sort in the same order: positive floats get their sign bit set, and negative ones have every bit
+// flipped (so that the larger the magnitude, the smaller the key). -0.0 and +0.0 get neighboring keys.
+//
+static uint32_t floatKey(float value)
+{
+	uint32_t bits;
+
+	memcpy( &bits, &value, sizeof( bits ) );
+
+	return ( bits & 0x80000000u ) ? ~bits : ( bits | 0x80000000u );
+}
+
+static float keyFloat(uint32_t key)
+{
+	uint32_t bits = ( key & 0x80000000u ) ? ( key & 0x7FFFFFFFu ) : ~key;
+	float value;
+
+	memcpy( &value, &bits, sizeof( value ) );
+
+	return value;
+}
+
+// The smallest float >= "value"
+//
+static float floatAtOrAbove(double value)
+{
+	float ret = (float) value;
+
+	if( (double) ret < value ) ret = nextafterf( ret, INFINITY );
+
+	return ret;
+}
+
+// ilogb and ldexp, straight from the bits, since these are worked out for every input (and the library calls doubled the time
+// a float sweep took). exponentOf returns -1023 for 0 and the subnormals, and 1024 for infinities and NaNs.
+//
+static inline int exponentOf(double value)
+{
+	uint64_t bits;
+
+	memcpy( &bits, &value, sizeof( bits ) );
+
+	return (int)( ( bits >> 52 ) & 0x7FF ) - 1023;
+}
+
+static inline double powerOfTwo(int exponent)
+{
+	uint64_t bits = ( exponent >= -1022 ) ? ( (uint64_t)( exponent + 1023 ) << 52 ) : ( 1ull << ( exponent + 1074 ) );
+	double ret;
+
+	memcpy( &ret, &bits, sizeof( ret ) );
+
+	return ret;
+}
+
+static inline double ulp(double value, int precision, int minExponent)
+{
+	int exponent = exponentOf( value );
+
+	if( exponent < minExponent ) exponent = minExponent;
+
+	return powerOfTwo( exponent - ( precision - 1 ) );
+}
+
+double accuracyHistogram_binLimit(int bin)
+{
+	ASSERT( ( bin >= 0 ) && ( bin < ACCURACY_HISTOGRAM_BINS ) );
+
+	return ( bin == ACCURACY_HISTOGRAM_BINS - 1 ) ? INFINITY : ldexp( 1.0, bin - 1 );
+}
+
+static void accumulate(sweepAccumulator_t * p_accumulator, double input, double output, long double reference, double ulpSize)
+{
+	double absoluteError = (double) fabsl( (long double) output - reference );
+	double ulpError = absoluteError / ulpSize;
+	int first = ( p_accumulator->inputs == 0 );
+	int bin = 0;
+
+	p_accumulator->inputs++;
+	p_accumulator->absoluteError_sum += absoluteError;
+
+	// Ties go to the smaller input, so that the result doesn't depend on which thread got there first
+	//
+	if( first || ( absoluteError > p_accumulator->absoluteError_max ) ||
+		( ( absoluteError == p_accumulator->absoluteError_max ) && ( input < p_accumulator->absoluteError_argmax ) ) )
+	{
+		p_accumulator->absoluteError_max = absoluteError;
+		p_accumulator->absoluteError_argmax = input;
+	}
+	if( first || ( ulpError > p_accumulator->ulpError_max ) ||
+		( ( ulpError == p_accumulator->ulpError_max ) && ( input < p_accumulator->ulpError_argmax ) ) )
+	{
+		p_accumulator->ulpError_max = ulpError;
+		p_accumulator->ulpError_argmax = input;
+	}
+
+	// An error in [2^e, 2^(e+1)) ULPs goes in bin e+2. A NaN (which no other bin would take) goes in the last bin.
+	//
+	if( !( ulpError < 0.5 ) )
+	{
+		int exponent = exponentOf( ulpError ) + 2;
+
+		bin = ( exponent < ACCURACY_HISTOGRAM_BINS - 1 ) ? exponent : ( ACCURACY_HISTOGRAM_BINS - 1 );
+	}
+	p_accumulator->histogram[bin]++;
+}
+
+// A random input from slice "idx" of the domain. Each slice's random number only depends on the seed and the slice, so the
+// inputs are the same however the slices are split between threads.
+//
+static double stratifiedInput(const sweepWork_t * p_work, uint64_t idx)
+{
+	xorshift_t rng;
+	double min = p_work->p_config->domain_min, max = p_work->p_config->domain_max;
+
+	xorshift_seed( &rng, p_work->p_config->seed + idx );
+
+	double ret = min + ( ( (double) idx + xorshift_uniform( &rng ) ) * ( ( max - min ) / (double) p_work->indices ) );
+
+	return ( ret < max ) ? ret : nextafter( max, -INFINITY );
+}
+
+static q9_22_t stratifiedCode(const sweepWork_t * p_work, uint64_t idx)
+{
+	xorshift_t rng;
+	uint64_t begin = ( idx * p_work->codes ) / p_work->indices;
+	uint64_t end = ( ( idx + 1 ) * p_work->codes ) / p_work->indices;
+
+	xorshift_seed( &rng, p_work->p_config->seed + idx );
+
+	return (q9_22_t)( p_work->code_begin + (int64_t)( begin + ( xorshift_next( &rng ) % ( end - begin ) ) ) );
+}
+
+static double sweepInput(const sweepWork_t * p_work, uint64_t idx)
+{
+	return ( p_work->kind == SWEEP_EVERY_FLOAT ) ? (double) keyFloat( (uint32_t) idx ) : stratifiedInput( p_work, idx );
+}
+
+static q9_22_t sweepCode(const sweepWork_t * p_work, uint64_t idx)
+{
+	return ( p_work->kind == SWEEP_EVERY_CODE ) ? (q9_22_t)( p_work->code_begin + (int64_t) idx ) : stratifiedCode( p_work, idx );
+}
+
+static void sweep_run(void * p_context, uint32_t thread)
+{
+	sweepWork_t * p_work = (sweepWork_t *)p_context;
+	const sinLUT_implementation_t * p_CUT = p_work->p_CUT;
+	sweepAccumulator_t * p_accumulator = &p_work->p_accumulators[thread];
+	uint64_t begin, end;
+
+	while( rangeSplitter_next( p_work->p_splitter, thread, &begin, &end ) )
+	{
+		switch( p_CUT->function_enum )
+		{
+			case fcn_dbl_in_dbl_out:
+				for( uint64_t idx = begin; idx < end; idx++ )
+				{
+					double input = sweepInput( p_work, idx ), output = p_CUT->fcn_double( input );
+					long double reference = referenceSin( input );
+					accumulate( p_accumulator, input, output, reference, ulp( (double) reference, DOUBLE_PRECISION, DOUBLE_MIN_EXPONENT ) );
+				}
+			break;
+
+			case fcn_flt_in_flt_out:
+				for( uint64_t idx = begin; idx < end; idx++ )
+				{
+					float input = (float) sweepInput( p_work, idx ), output = p_CUT->fcn_float( input );
+					long double reference = referenceSin( input );
+					accumulate( p_accumulator, input, output, reference, ulp( (double) reference, FLOAT_PRECISION, FLOAT_MIN_EXPONENT ) );
+				}
+			break;
+
+			case fcn_fxd_in_fxd_out:
+				for( uint64_t idx = begin; idx < end; idx++ )
+				{
+					q9_22_t input = sweepCode( p_work, idx );
+					q0_31_t output = p_CUT->fcn_fixedPoint( input );
+					accumulate( p_accumulator, TOFLT(input, 22), TOFLT(output, 31), referenceSin( TOFLT(input, 22) ), Q0_31_ULP );
+				}
+			break;
+
+			case fcn_dbl_arr_dbl_arr:
+				for( uint64_t batch = begin; batch < end; batch += ACCURACY_BATCH )
+				{
+					double inputs[ACCURACY_BATCH], outputs[ACCURACY_BATCH];
+					size_t n = ( end - batch < ACCURACY_BATCH ) ? (size_t)( end - batch ) : ACCURACY_BATCH;
+
+					for( size_t idx = 0; idx < n; idx++ ) inputs[idx] = sweepInput( p_work, batch + idx );
+					p_CUT->fcn_double_batch( inputs, outputs, n );
+					for( size_t idx = 0; idx < n; idx++ )
+					{
+						long double reference = referenceSin( inputs[idx] );
+						accumulate( p_accumulator, inputs[idx], outputs[idx], reference, ulp( (double) reference, DOUBLE_PRECISION, DOUBLE_MIN_EXPONENT ) );
+					}
+				}
+			break;
+
+			case fcn_flt_arr_flt_arr:
+				for( uint64_t batch = begin; batch < end; batch += ACCURACY_BATCH )
+				{
+					float inputs[ACCURACY_BATCH], outputs[ACCURACY_BATCH];
+					size_t n = ( end - batch < ACCURACY_BATCH ) ? (size_t)( end - batch ) : ACCURACY_BATCH;
+
+					for( size_t idx = 0; idx < n; idx++ ) inputs[idx] = (float) sweepInput( p_work, batch + idx );
+					p_CUT->fcn_float_batch( inputs, outputs, n );
+					for( size_t idx = 0; idx < n; idx++ )
+					{
+						long double reference = referenceSin( inputs[idx] );
+						accumulate( p_accumulator, inputs[idx], outputs[idx], reference, ulp( (double) reference, FLOAT_PRECISION, FLOAT_MIN_EXPONENT ) );
+					}
+				}
+			break;
+
+			case fcn_fxd_arr_fxd_arr:
+				for( uint64_t batch = begin; batch < end; batch += ACCURACY_BATCH )
+				{
+					q9_22_t inputs[ACCURACY_BATCH];
+					q0_31_t outputs[ACCURACY_BATCH];
+					size_t n = ( end - batch < ACCURACY_BATCH ) ? (size_t)( end - batch ) : ACCURACY_BATCH;
+
+					for( size_t idx = 0; idx < n; idx++ ) inputs[idx] = sweepCode( p_work, batch + idx );
+					p_CUT->fcn_fixedPoint_batch( inputs, outputs, n );
+					for( size_t idx = 0; idx < n; idx++ )
+					{
+						accumulate( p_accumulator, TOFLT(inputs[idx], 22), TOFLT(outputs[idx], 31), referenceSin( TOFLT(inputs[idx], 22) ), Q0_31_ULP );
+					}
+				}
+			break;
+
+			default:
+				ASSERT(0);
+			// Unreachable
+			break;
+		}
+	}
+}
+
+errno_t accuracy_sweep(const sinLUT_implementation_t * p_CUT, const accuracyConfig_t * p_config, accuracyResult_t * p_result)
+{
+	errno_t err = 0;
+	sweepWork_t work = { .p_CUT = p_CUT, .p_config = p_config };
+	uint64_t index_begin = 0;
+
+	ASSERT( ( p_CUT != NULL ) && ( p_config != NULL ) && ( p_result != NULL ) );
+	ASSERT( ( p_CUT->function_enum != fcn_scaffolding ) && ( p_CUT->function_enum != fcn_unsupported ) );
+	ASSERT( isfinite( p_config->domain_min ) && isfinite( p_config->domain_max ) && ( p_config->domain_min < p_config->domain_max ) );
+	ASSERT( ( p_config->samples > 0 ) && ( p_config->threads > 0 ) );
+
+	memset( p_result, 0, sizeof( *p_result ) );
+
+	switch( p_CUT->function_enum )
+	{
+		case fcn_flt_in_flt_out:
+		case fcn_flt_arr_flt_arr:
+			work.kind = SWEEP_EVERY_FLOAT;
+			index_begin = floatKey( floatAtOrAbove( p_config->domain_min ) );
+			work.indices = (uint64_t) floatKey( floatAtOrAbove( p_config->domain_max ) ) - index_begin;
+		break;
+
+		// The q9.22 codes in the domain (the part of it a q9.22 can hold)
+		//
+		case fcn_fxd_in_fxd_out:
+		case fcn_fxd_arr_fxd_arr:
+		{
+			int64_t code_end = (int64_t) ceil( ldexp( fmin( p_config->domain_max, 512.0 ), 22 ) );
+
+			work.code_begin = (int64_t) ceil( ldexp( fmax( p_config->domain_min, -512.0 ), 22 ) );
+			if( work.code_begin < Q9_22_MIN_CODE ) work.code_begin = Q9_22_MIN_CODE;
+			if( code_end > Q9_22_END_CODE ) code_end = Q9_22_END_CODE;
+			work.codes = ( code_end > work.code_begin ) ? (uint64_t)( code_end - work.code_begin ) : 0;
+			work.kind = ( work.codes <= p_config->samples ) ? SWEEP_EVERY_CODE : SWEEP_STRATIFIED_CODE;
+			work.indices = ( work.kind == SWEEP_EVERY_CODE ) ? work.codes : p_config->samples;
+		}
+		break;
+
+		default:
+			work.kind = SWEEP_STRATIFIED;
+			work.indices = p_config->samples;
+		break;
+	}
+
+	// Every other kind of sweep numbers its inputs from 0, but a float sweep's indices are the floats' keys
+	//
+	work.p_splitter = rangeSplitter_create( index_begin, index_begin + work.indices, p_config->threads, ACCURACY_CHUNK );
+	work.p_accumulators = (sweepAccumulator_t *)calloc( p_config->threads, sizeof( sweepAccumulator_t ) );
+
+	if( ( work.p_splitter != NULL ) && ( work.p_accumulators != NULL ) )
+	{
+		threadWork_t threadWork = { NULL, sweep_run, NULL, &work };
+
+		err = runOnThreads( p_config->threads, &threadWork, &p_result->elapsed_ns );
+	}
+	else err = -1;
+
+	if( err == 0 )
+	{
+		double absoluteError_sum = 0.0;
+
+		p_result->exhaustive = ( work.kind == SWEEP_EVERY_FLOAT ) || ( work.kind == SWEEP_EVERY_CODE );
+		p_result->absoluteError_argmax = NAN;
+		p_result->ulpError_argmax = NAN;
+
+		for( uint32_t thread = 0; thread < p_config->threads; thread++ )
+		{
+			const sweepAccumulator_t * p_accumulator = &work.p_accumulators[thread];
+
+			if( p_accumulator->inputs == 0 ) continue;
+
+			p_result->inputs += p_accumulator->inputs;
+			absoluteError_sum += p_accumulator->absoluteError_sum;
+
+			if( isnan( p_result->absoluteError_argmax ) || ( p_accumulator->absoluteError_max > p_result->absoluteError_max ) ||
+				( ( p_accumulator->absoluteError_max == p_result->absoluteError_max ) && ( p_accumulator->absoluteError_argmax < p_result->absoluteError_argmax ) ) )
+			{
+				p_result->absoluteError_max = p_accumulator->absoluteError_max;
+				p_result->absoluteError_argmax = p_accumulator->absoluteError_argmax;
+			}
+			if( isnan( p_result->ulpError_argmax ) || ( p_accumulator->ulpError_max > p_result->ulpError_max ) ||
+				( ( p_accumulator->ulpError_max == p_result->ulpError_max ) && ( p_accumulator->ulpError_argmax < p_result->ulpError_argmax ) ) )
+			{
+				p_result->ulpError_max = p_accumulator->ulpError_max;
+				p_result->ulpError_argmax = p_accumulator->ulpError_argmax;
+			}
+
+			for( int bin = 0; bin < ACCURACY_HISTOGRAM_BINS; bin++ ) p_result->histogram[bin] += p_accumulator->histogram[bin];
+		}
+
+		p_result->absoluteError_avg = ( p_result->inputs > 0 ) ? ( absoluteError_sum / (double) p_result->inputs ) : 0.0;
+	}
+
+	rangeSplitter_destroy( work.p_splitter );
+	free( work.p_accumulators );
+
+	return err;
+}
@@ -0,0 +1,195 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "input_generator.h"
+#include "range_reduction.h"
+#include "sin_lut.h"
+#include "assert.h"
+
+// How far INPUT_SWEEP moves each time (about 1/4096 of a period), the largest step INPUT_RANDOM_WALK takes either way, the
+// number of operating points INPUT_GAUSSIAN clusters around and how far it strays from them (one standard deviation), and how
+// many ULPs either side of a boundary INPUT_ADVERSARIAL goes.
+//
+#define SWEEP_STEP ( TWO_PI_DOUBLE / 4096.0 )
+#define RANDOM_WALK_STEP 0.05
+#define GAUSSIAN_CLUSTERS 4
+#define GAUSSIAN_SIGMA 0.05
+#define ADVERSARIAL_ULPS 4
+
+struct inputGenerator_t
+{
+	inputDistribution_t distribution;
+	uint64_t seed;
+	xorshift_t rng;
+	double phase;
+	double centers[GAUSSIAN_CLUSTERS];
+	const double * p_replay;
+	size_t replay_size;
+	size_t replay_idx;
+};
+
+// splitmix64, to turn any seed (including 0 and other seeds with few bits set) into a well-mixed, non-zero starting state
+//
+void xorshift_seed(xorshift_t * p_rng, uint64_t seed)
+{
+	uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+
+	z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+	z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+	z = z ^ ( z >> 31 );
+
+	p_rng->state = ( z != 0 ) ? z : 0x9E3779B97F4A7C15ull;
+}
+
+uint64_t xorshift_next(xorshift_t * p_rng)
+{
+	uint64_t x = p_rng->state;
+
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	p_rng->state = x;
+
+	return x * 0x2545F4914F6CDD1Dull;
+}
+
+double xorshift_uniform(xorshift_t * p_rng)
+{
+	return (double)( xorshift_next( p_rng ) >> 11 ) * 0x1.0p-53;
+}
+
+// A standard normal variate, by the Box-Muller transform. "1 - uniform" is in (0, 1], so the log is always finite.
+//
+static double xorshift_normal(xorshift_t * p_rng)
+{
+	double radius = sqrt( -2.0 * log( 1.0 - xorshift_uniform( p_rng ) ) );
+
+	return radius * cos( TWO_PI_DOUBLE * xorshift_uniform( p_rng ) );
+}
+
+static double wrap(double radians)
+{
+	if( radians >= TWO_PI_DOUBLE ) radians -= TWO_PI_DOUBLE;
+	if( radians < 0.0 ) radians += TWO_PI_DOUBLE;
+
+	return radians;
+}
+
+p_inputGenerator_t inputGenerator_create(inputDistribution_t distribution, uint64_t seed, const double * p_replay, size_t replay_size)
+{
+	ASSERT( distribution < NUM_INPUT_DISTRIBUTIONS );
+	if( distribution == INPUT_REPLAY ) ASSERT( ( p_replay != NULL ) && ( replay_size > 0 ) );
+
+	p_inputGenerator_t this = (p_inputGenerator_t)calloc(1, sizeof(struct inputGenerator_t));
+	if( this == NULL ) return NULL;
+
+	this->distribution = distribution;
+	this->seed = seed;
+	this->p_replay = p_replay;
+	this->replay_size = replay_size;
+	inputGenerator_reset( this );
+
+	return this;
+}
+
+void inputGenerator_destroy(p_inputGenerator_t this)
+{
+	free( this );
+}
+
+void inputGenerator_reset(p_inputGenerator_t this)
+{
+	ASSERT( this != NULL );
+
+	xorshift_seed( &this->rng, this->seed );
+	this->phase = TWO_PI_DOUBLE * xorshift_uniform( &this->rng );
+	for( int idx = 0; idx < GAUSSIAN_CLUSTERS; idx++ ) this->centers[idx] = TWO_PI_DOUBLE * xorshift_uniform( &this->rng );
+	this->replay_idx = 0;
+}
+
+double inputGenerator_next(p_inputGenerator_t this)
+{
+	double ret = 0.0;
+
+	ASSERT( this != NULL );
+
+	switch( this->distribution )
+	{
+		case INPUT_UNIFORM:
+			ret = TWO_PI_DOUBLE * xorshift_uniform( &this->rng );
+		break;
+
+		case INPUT_SWEEP:
+			ret = this->phase;
+			this->phase = wrap( this->phase + SWEEP_STEP );
+		break;
+
+		case INPUT_RANDOM_WALK:
+			ret = this->phase;
+			this->phase = wrap( this->phase + ( RANDOM_WALK_STEP * ( ( 2.0 * xorshift_uniform( &this->rng ) ) - 1.0 ) ) );
+		break;
+
+		case INPUT_GAUSSIAN:
+			ret = this->centers[ xorshift_next( &this->rng ) % GAUSSIAN_CLUSTERS ] + ( GAUSSIAN_SIGMA * xorshift_normal( &this->rng ) );
+		break;
+
+		case INPUT_LARGE:
+		{
+			double magnitude = TWO_PI_DOUBLE * pow( INPUT_LARGE_MAX / TWO_PI_DOUBLE, xorshift_uniform( &this->rng ) );
+			ret = ( xorshift_next( &this->rng ) & 1 ) ? -magnitude : magnitude;
+		}
+		break;
+
+		case INPUT_ADVERSARIAL:
+		{
+			uint64_t random = xorshift_next( &this->rng );
+			int ulps = (int)( ( random >> 32 ) % ( ( 2 * ADVERSARIAL_ULPS ) + 1 ) ) - ADVERSARIAL_ULPS;
+
+			ret = sin_LUT_boundary( (size_t)( ( random & UINT32_MAX ) % sin_LUT_boundaryCount() ) );
+			for( ; ulps > 0; ulps-- ) ret = nextafter( ret, INFINITY );
+			for( ; ulps < 0; ulps++ ) ret = nextafter( ret, -INFINITY );
+		}
+		break;
+
+		case INPUT_REPLAY:
+			ret = this->p_replay[ this->replay_idx ];
+			this->replay_idx = ( this->replay_idx + 1 ) % this->replay_size;
+		break;
+
+		default:
+			ASSERT(0);
+		// Unreachable
+		break;
+	}
+
+	return ret;
+}
+
+void inputGenerator_fill(p_inputGenerator_t this, double * p_inputs, size_t n)
+{
+	for( size_t idx = 0; idx < n; idx++ ) p_inputs[idx] = inputGenerator_next( this );
+}
+
+static const char * distributionNames[NUM_INPUT_DISTRIBUTIONS] =
+{
+	"uniform", "sweep", "walk", "gaussian", "large", "adversarial", "replay"
+};
+
+const char * inputDistribution_name(inputDistribution_t distribution)
+{
+	return ( distribution < NUM_INPUT_DISTRIBUTIONS ) ? distributionNames[distribution] : "unknown";
+}
+
+int inputDistribution_find(const char * name, inputDistribution_t * p_distribution)
+{
+	for( int idx = 0; idx < NUM_INPUT_DISTRIBUTIONS; idx++ )
+	{
+		if( strcmp( name, distributionNames[idx] ) == 0 )
+		{
+			*p_distribution = (inputDistribution_t)idx;
+			return 0;
+		}
+	}
+
+	return -1;
+}
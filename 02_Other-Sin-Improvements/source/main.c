@@ -1,11 +1,17 @@
-// Enforce -O0 optimization level (so that calls to sin and sin_LUT don't get optimized away)
+// The harness is built at the same optimization level as everything else; the barriers in benchmark.h are what keep the calls
+// being timed from getting optimized away.
 //
-#pragma GCC push_options
-#pragma GCC optimize ("O0")
-
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "main.h"
+#include "accuracy.h"
+#include "statistics.h"
+#include "benchmark.h"
+#include "input_generator.h"
+#include "reference.h"
+#include "range_reduction.h"
 #include "sin_lut.h"
 #include "sincos.h"
 #include "hardwareAPI.h"
@@ -16,101 +22,1106 @@
 //
 volatile uint32_t testIterations = 1000;
 
+// Each function is also called warmupIterations times before any timing is recorded, so that its code and tables are already
+// in cache and the branch predictors have been trained. outlierTrimFraction is the fraction of the slowest per-call timings
+// left out of the mean, stddev and confidence interval (see timingStats_compute). Both can be updated with a debugger as well.
+//
+volatile uint32_t warmupIterations = 100;
+volatile double outlierTrimFraction = 0.01;
+
+// Number of inputs passed to the array LUTs on each test iteration. Their execution time and error are reported per input so
+// that they can be compared directly against the scalar LUTs.
+//
+#define BATCH_SIZE 64
+
+// Besides timing each call on its own (which mostly measures the timer), every function is timed over a block of BLOCK_SIZE
+// inputs between two reads of the cycle counter, BLOCK_REPEATS times, and the total divided by the number of calls. The block
+// is small enough for the inputs and outputs to stay in cache (and to fit in the STM32's RAM). This is done twice, once for
+// each benchmarkMode_t.
+//
+#define BLOCK_SIZE 256
+#define BLOCK_REPEATS 100
+
+typedef struct block_t
+{
+	double input_double[BLOCK_SIZE], output_double[BLOCK_SIZE];
+	float input_float[BLOCK_SIZE], output_float[BLOCK_SIZE];
+	q9_22_t input_fixedPoint[BLOCK_SIZE];
+	q0_31_t output_fixedPoint[BLOCK_SIZE];
+} block_t;
+
+static block_t block;
+
+// A q9_22_t only holds inputs up to +/-512, so larger ones (see INPUT_LARGE) are wrapped first. fmod is exact, so the fixed-point
+// LUTs still see the same angle, less whatever error there is in TWO_PI_DOUBLE itself (relative to the input, about 1e-16).
+//
+#define Q9_22_INPUT_LIMIT 511.0
+
+static q9_22_t toFixedPointInput(double radians)
+{
+	if( fabs( radians ) >= Q9_22_INPUT_LIMIT ) radians = fmod( radians, TWO_PI_DOUBLE );
+
+	return TOFIX(radians, 22);
+}
+
+static void fillBlockInputs(block_t * p_block, p_inputGenerator_t p_inputs)
+{
+	inputGenerator_fill( p_inputs, p_block->input_double, BLOCK_SIZE );
+
+	for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+	{
+		p_block->input_float[idx] = (float) p_block->input_double[idx];
+		p_block->input_fixedPoint[idx] = toFixedPointInput( p_block->input_double[idx] );
+	}
+}
+
+// Call the function once on every input in the block (an array LUT gets the whole block in one call), with nothing linking
+// one call to the next
+//
+static void runBlock(const sinLUT_implementation_t * p_CUT, block_t * p_block)
+{
+	switch( p_CUT->function_enum )
+	{
+		case fcn_scaffolding:
+			for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+			{
+				double output = p_block->input_double[idx];
+				DO_NOT_OPTIMIZE( output );
+				p_block->output_double[idx] = output;
+			}
+		break;
+
+		case fcn_dbl_in_dbl_out:
+			for( int idx = 0; idx < BLOCK_SIZE; idx++ ) p_block->output_double[idx] = p_CUT->fcn_double( p_block->input_double[idx] );
+		break;
+
+		case fcn_flt_in_flt_out:
+			for( int idx = 0; idx < BLOCK_SIZE; idx++ ) p_block->output_float[idx] = p_CUT->fcn_float( p_block->input_float[idx] );
+		break;
+
+		case fcn_fxd_in_fxd_out:
+			for( int idx = 0; idx < BLOCK_SIZE; idx++ ) p_block->output_fixedPoint[idx] = p_CUT->fcn_fixedPoint( p_block->input_fixedPoint[idx] );
+		break;
+
+		case fcn_dbl_arr_dbl_arr:
+			p_CUT->fcn_double_batch( p_block->input_double, p_block->output_double, BLOCK_SIZE );
+		break;
+
+		case fcn_flt_arr_flt_arr:
+			p_CUT->fcn_float_batch( p_block->input_float, p_block->output_float, BLOCK_SIZE );
+		break;
+
+		case fcn_fxd_arr_fxd_arr:
+			p_CUT->fcn_fixedPoint_batch( p_block->input_fixedPoint, p_block->output_fixedPoint, BLOCK_SIZE );
+		break;
+
+		default:
+			ASSERT(0);
+		// Unreachable
+		break;
+	}
+}
+
+// In BENCHMARK_LATENCY mode, each input is "block_input[idx] + ( previous output * chain )". "chain" is 0, but the compiler
+// can't know that, so each call has to wait for the one before it; the cost of the multiply-add is part of every latency,
+// which is what the "Scaffolding" row measures. The array LUTs are chained one element at a time, so their latency is that of
+// calling them for a single input.
+//
+static double timeBlock_ns(const sinLUT_implementation_t * p_CUT, benchmarkMode_t mode)
+{
+	uint64_t cycles = 0;
+	double chain_double = 0.0;
+	float chain_float = 0.0f;
+	q0_31_t chain_fixedPoint = 0;
+
+	DO_NOT_OPTIMIZE( chain_double );
+	DO_NOT_OPTIMIZE( chain_float );
+	DO_NOT_OPTIMIZE( chain_fixedPoint );
+
+	for( int repeat = 0; repeat < BLOCK_REPEATS; repeat++ )
+	{
+		CLOBBER_MEMORY();
+		uint64_t start = readCycleCounter();
+
+		if( mode == BENCHMARK_LATENCY )
+		{
+			double output_double = 0.0;
+			float output_float = 0.0f;
+			q0_31_t output_fixedPoint = 0;
+			double input_double;
+			float input_float;
+			q9_22_t input_fixedPoint;
+
+			switch( p_CUT->function_enum )
+			{
+				case fcn_scaffolding:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						output_double = block.input_double[idx] + ( output_double * chain_double );
+					}
+				break;
+
+				case fcn_dbl_in_dbl_out:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						output_double = p_CUT->fcn_double( block.input_double[idx] + ( output_double * chain_double ) );
+					}
+				break;
+
+				case fcn_flt_in_flt_out:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						output_float = p_CUT->fcn_float( block.input_float[idx] + ( output_float * chain_float ) );
+					}
+				break;
+
+				case fcn_fxd_in_fxd_out:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						output_fixedPoint = p_CUT->fcn_fixedPoint( block.input_fixedPoint[idx] + ( output_fixedPoint * chain_fixedPoint ) );
+					}
+				break;
+
+				case fcn_dbl_arr_dbl_arr:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						input_double = block.input_double[idx] + ( output_double * chain_double );
+						p_CUT->fcn_double_batch( &input_double, &output_double, 1 );
+					}
+				break;
+
+				case fcn_flt_arr_flt_arr:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						input_float = block.input_float[idx] + ( output_float * chain_float );
+						p_CUT->fcn_float_batch( &input_float, &output_float, 1 );
+					}
+				break;
+
+				case fcn_fxd_arr_fxd_arr:
+					for( int idx = 0; idx < BLOCK_SIZE; idx++ )
+					{
+						input_fixedPoint = block.input_fixedPoint[idx] + ( output_fixedPoint * chain_fixedPoint );
+						p_CUT->fcn_fixedPoint_batch( &input_fixedPoint, &output_fixedPoint, 1 );
+					}
+				break;
+
+				default:
+					ASSERT(0);
+				// Unreachable
+				break;
+			}
+
+			DO_NOT_OPTIMIZE( output_double );
+			DO_NOT_OPTIMIZE( output_float );
+			DO_NOT_OPTIMIZE( output_fixedPoint );
+		}
+		else runBlock( p_CUT, &block );
+
+		CLOBBER_MEMORY();
+		cycles += readCycleCounter() - start;
+	}
+
+	return (double) cycles * cycleCounterPeriod_ns() / ( (double) BLOCK_SIZE * BLOCK_REPEATS );
+}
+
+// Time one call on its own (or one batch of BATCH_SIZE inputs, for the array LUTs) with the cycle counter, "repeats" times, and
+// return the median in ns per input. With "cold" set, the function's tables are evicted from the cache before every call, as
+// they would be in code that only looks up a sin once in a while; otherwise they're still in cache from the call before. The
+// inputs are the block inputs, in order. "p_samples" has to hold "repeats" timings.
+//
+static double timeSingleCall_ns(const sinLUT_implementation_t * p_CUT, int cold, uint32_t * p_samples, uint32_t repeats)
+{
+	uint32_t inputsPerCall = 1;
+	timingStats_t stats;
+
+	if( fcnSignature_isBatch( p_CUT->function_enum ) ) inputsPerCall = BATCH_SIZE;
+
+	for( uint32_t repeat = 0; repeat < repeats; repeat++ )
+	{
+		uint32_t idx = ( repeat * inputsPerCall ) % BLOCK_SIZE;
+		double input_double = block.input_double[idx], output_double = 0.0;
+		float input_float = block.input_float[idx], output_float = 0.0f;
+		q9_22_t input_fixedPoint = block.input_fixedPoint[idx];
+		q0_31_t output_fixedPoint = 0;
+
+		if( cold )
+		{
+			for( int table = 0; table < SIN_LUT_MAX_TABLES; table++ ) evictFromCache( p_CUT->tables[table].p_start, p_CUT->tables[table].bytes );
+		}
+
+		DO_NOT_OPTIMIZE( input_double );
+		DO_NOT_OPTIMIZE( input_float );
+		DO_NOT_OPTIMIZE( input_fixedPoint );
+		CLOBBER_MEMORY();
+		uint64_t start = readCycleCounter();
+
+		switch( p_CUT->function_enum )
+		{
+			case fcn_scaffolding: output_double = input_double; break;
+			case fcn_dbl_in_dbl_out: output_double = p_CUT->fcn_double( input_double ); break;
+			case fcn_flt_in_flt_out: output_float = p_CUT->fcn_float( input_float ); break;
+			case fcn_fxd_in_fxd_out: output_fixedPoint = p_CUT->fcn_fixedPoint( input_fixedPoint ); break;
+			case fcn_dbl_arr_dbl_arr: p_CUT->fcn_double_batch( &block.input_double[idx], block.output_double, BATCH_SIZE ); break;
+			case fcn_flt_arr_flt_arr: p_CUT->fcn_float_batch( &block.input_float[idx], block.output_float, BATCH_SIZE ); break;
+			case fcn_fxd_arr_fxd_arr: p_CUT->fcn_fixedPoint_batch( &block.input_fixedPoint[idx], block.output_fixedPoint, BATCH_SIZE ); break;
+			default: ASSERT(0); break;
+		}
+
+		DO_NOT_OPTIMIZE( output_double );
+		DO_NOT_OPTIMIZE( output_float );
+		DO_NOT_OPTIMIZE( output_fixedPoint );
+		CLOBBER_MEMORY();
+		p_samples[repeat] = (uint32_t)( readCycleCounter() - start );
+	}
+
+	timingStats_compute( p_samples, repeats, 0.0, &stats );
+
+	return stats.median * cycleCounterPeriod_ns() / inputsPerCall;
+}
+
+// Every statistic of a set of timings scales with them, so the array LUTs can be summarized per batch and then scaled down to
+// per input.
+//
+static void scaleTimingStats(timingStats_t * stats, double scale)
+{
+	stats->min *= scale;
+	stats->median *= scale;
+	stats->p90 *= scale;
+	stats->p99 *= scale;
+	stats->p999 *= scale;
+	stats->max *= scale;
+	stats->mean *= scale;
+	stats->stddev *= scale;
+	stats->ci95 *= scale;
+}
+
+// The reference answers for the inputs the functions are given, worked out once up front (the more precise oracles take up to
+// a microsecond a call) instead of once for every function. Every function is given the same inputs, in the same order, so
+// entry N is the answer for the Nth input from the generator: as a double, rounded to a float and rounded to a q9.22 (since
+// far from 0 that rounding alone can change the answer). If there wasn't room for them, the arrays are NULL and the answers
+// are worked out as they're needed.
+//
+typedef struct referenceCache_t
+{
+	size_t size;
+	long double * p_double;
+	long double * p_float;
+	long double * p_fixedPoint;
+} referenceCache_t;
+
+static void referenceCache_fill(referenceCache_t * p_cache, p_inputGenerator_t p_inputs, size_t size)
+{
+	p_cache->size = size;
+	p_cache->p_double = (long double *)malloc( size * sizeof( long double ) );
+	p_cache->p_float = (long double *)malloc( size * sizeof( long double ) );
+	p_cache->p_fixedPoint = (long double *)malloc( size * sizeof( long double ) );
+
+	if( ( p_cache->p_double == NULL ) || ( p_cache->p_float == NULL ) || ( p_cache->p_fixedPoint == NULL ) )
+	{
+		free( p_cache->p_double );
+		free( p_cache->p_float );
+		free( p_cache->p_fixedPoint );
+		p_cache->p_double = p_cache->p_float = p_cache->p_fixedPoint = NULL;
+		return;
+	}
+
+	inputGenerator_reset( p_inputs );
+	for( size_t idx = 0; idx < size; idx++ )
+	{
+		double input = inputGenerator_next( p_inputs );
+
+		p_cache->p_double[idx] = referenceSin( input );
+		p_cache->p_float[idx] = referenceSin( (double)(float) input );
+		p_cache->p_fixedPoint[idx] = referenceSin( TOFLT(toFixedPointInput( input ), 22) );
+	}
+}
+
+static void referenceCache_free(referenceCache_t * p_cache)
+{
+	free( p_cache->p_double );
+	free( p_cache->p_float );
+	free( p_cache->p_fixedPoint );
+}
+
+// The reference answer for input number "idx", which was "input" once it was rounded to what a function with this signature
+// takes
+//
+static long double referenceCache_get(const referenceCache_t * p_cache, fcnSignature_t signature, size_t idx, double input)
+{
+	const long double * p_references = p_cache->p_double;
+
+	if( ( signature == fcn_flt_in_flt_out ) || ( signature == fcn_flt_arr_flt_arr ) ) p_references = p_cache->p_float;
+	else if( ( signature == fcn_fxd_in_fxd_out ) || ( signature == fcn_fxd_arr_fxd_arr ) ) p_references = p_cache->p_fixedPoint;
+
+	return ( ( p_references != NULL ) && ( idx < p_cache->size ) ) ? p_references[idx] : referenceSin( input );
+}
+
+// "reference" is the correct answer for the input the function was actually given (see referenceCache_t). The error is worked
+// out at the reference's precision, so that it isn't lost in the rounding to a double.
+//
+static void addError(sinLUT_implementation_t * p_CUT, long double reference, double output_CUT, double weight)
+{
+	// Add current absolute error to the running total
+	//
+	double output_sin = (double) reference;
+	double absoluteError = (double) fabsl( reference - (long double) output_CUT );
+	p_CUT->absoluteError_sum += absoluteError * weight;
+	if( absoluteError > p_CUT->absoluteError_max ) p_CUT->absoluteError_max = absoluteError;
+
+	// Add current percent error to the running total
+	//
+	double percentError;
+	double expected = fabs( output_sin );
+	if ( expected != 0 ) percentError = absoluteError / expected * 100.0;
+	else percentError = 100.0;
+	p_CUT->percentError_sum += percentError * weight;
+}
+
+// The harness's own entries: the timing overhead, the C library's sin (the reference everything else is measured against) and
+// Ganssle's polynomial approximations (in a library, which can't register itself). Their error bounds are from the measured
+// (or, for the polynomials, published) accuracy; none of them uses a table.
+//
+static const sinLUT_registration_t harness_registrations[] =
+{
+	{ .name = "Scaffolding", .signature = fcn_scaffolding, .fcn_double = NULL, .errorBound = 1.0 },
+	{ .name = "Library Sin", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin, .errorBound = 1e-15 },
+	{ .name = "Sin_32\t", .signature = fcn_flt_in_flt_out, .fcn_float = sin_32, .errorBound = 6e-4 },
+	{ .name = "Sin_52\t", .signature = fcn_flt_in_flt_out, .fcn_float = sin_52, .errorBound = 7e-6 },
+	{ .name = "Sin_73\t", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_73, .errorBound = 5e-8 },
+	{ .name = "Sin_121\t", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_121, .errorBound = 1e-12 },
+};
+
+SIN_LUT_REGISTER( harness_registrations )
+
+// Command-line options (none of which the embedded targets can be given, so the defaults have to make sense on their own)
+//
+typedef struct harnessOptions_t
+{
+	outputFormat_t format;
+	const char * baselineFile;
+	double regressionThreshold;
+	const char * filter;
+	uint32_t iterations;
+	int seedGiven;
+	uint32_t seed;
+	int list;
+	inputDistribution_t inputs;
+	const char * replayFile;
+	int coldCache;
+	uint32_t threads;
+	int replicateTables;
+	int accuracy;
+	referenceOracle_t reference;
+	sinLUT_values_t tableValues;
+	double domain_min;
+	double domain_max;
+	uint32_t samples;
+} harnessOptions_t;
+
+static void printUsage(const char * program)
+{
+	fprintf(stderr, "Usage: %s [--format=table|csv|json] [--baseline=FILE] [--threshold=FRACTION] [--filter=REGEX]\n", program);
+	fprintf(stderr, "       [--iterations=N] [--seed=N] [--list] [--inputs=DISTRIBUTION] [--replay=FILE] [--cold-cache]\n");
+	fprintf(stderr, "       [--threads[=N]] [--replicate-tables] [--accuracy] [--domain=MIN:MAX] [--samples=N]\n");
+	fprintf(stderr, "       [--reference=double|long-double|float128] [--table-values=exact|minimax]\n");
+	fprintf(stderr, "  --format      How to print the results (default: table)\n");
+	fprintf(stderr, "  --baseline    Compare against a previous run saved with --format=csv and exit with a non-zero status\n");
+	fprintf(stderr, "                if any median time or max error got worse by more than the threshold\n");
+	fprintf(stderr, "  --threshold   How much worse counts as a regression, as a fraction (default: 0.1, i.e. 10%%)\n");
+	fprintf(stderr, "  --filter      Only run the functions whose names match this (POSIX extended) regular expression\n");
+	fprintf(stderr, "  --iterations  Number of timed calls to each function (default: %u)\n", (unsigned) testIterations);
+	fprintf(stderr, "  --seed        Seed for the random inputs, to repeat a run exactly (default: the current time)\n");
+	fprintf(stderr, "  --list        Print the functions that would be run, and what's known about them, instead of running them\n");
+	fprintf(stderr, "  --inputs      How the inputs are distributed (default: uniform); one of:\n");
+	fprintf(stderr, "               ");
+	for( int idx = 0; idx < NUM_INPUT_DISTRIBUTIONS; idx++ ) fprintf(stderr, " %s", inputDistribution_name( (inputDistribution_t)idx ));
+	fprintf(stderr, "\n                (see input_generator.h)\n");
+	fprintf(stderr, "  --replay      Use the inputs in FILE (raw doubles, in this machine's byte order); implies --inputs=replay\n");
+	fprintf(stderr, "  --cold-cache  Also time single calls with each function's tables evicted from the cache, against the same calls\n");
+	fprintf(stderr, "                with the tables in cache\n");
+	fprintf(stderr, "  --threads     Instead of the usual results, measure how each function's throughput scales on 1, 2, 4, ... up\n");
+	fprintf(stderr, "                to N threads (default: every CPU this process may run on), each pinned to its own CPU\n");
+	fprintf(stderr, "  --replicate-tables  With --threads, also compare the interpolated array LUTs reading one shared table against\n");
+	fprintf(stderr, "                each thread reading its own copy\n");
+	fprintf(stderr, "  --accuracy    Instead of the usual results, measure each function's error over the whole domain: every float\n");
+	fprintf(stderr, "                for the float functions, stratified samples for the others (see accuracy.h), on every CPU\n");
+	fprintf(stderr, "                (or on --threads of them)\n");
+	fprintf(stderr, "  --domain      The inputs the accuracy sweep covers, [MIN, MAX) (default: 0:2*PI)\n");
+	fprintf(stderr, "  --samples     Number of stratified samples the accuracy sweep takes (default: %lu)\n", (unsigned long) ACCURACY_DEFAULT_SAMPLES);
+	fprintf(stderr, "  --reference   What the errors are measured against: the C library's sin, sinl or (if this build has\n");
+	fprintf(stderr, "                libquadmath) sinq (default: double; see reference.h)\n");
+	fprintf(stderr, "  --table-values  Fill the uniform LUTs with sin at each step or with values adjusted to minimize the largest\n");
+	fprintf(stderr, "                error (default: exact; see sin_lut.h)\n");
+}
+
+// Parse an unsigned decimal number that fits in 32 bits. Returns 0 if "text" is one.
+//
+static int parseUnsigned(const char * text, uint32_t * p_value)
+{
+	char * end;
+	unsigned long value = strtoul( text, &end, 10 );
+
+	if( ( *text == '\0' ) || ( *text == '-' ) || ( *end != '\0' ) || ( value > UINT32_MAX ) ) return -1;
+	*p_value = (uint32_t) value;
+
+	return 0;
+}
+
+// Returns 0 if every argument was understood
+//
+static int parseOptions(int argc, char * argv[], harnessOptions_t * p_options)
+{
+	p_options->format = OUTPUT_TABLE;
+	p_options->baselineFile = NULL;
+	p_options->regressionThreshold = 0.1;
+	p_options->filter = NULL;
+	p_options->iterations = testIterations;
+	p_options->seedGiven = 0;
+	p_options->seed = 0;
+	p_options->list = 0;
+	p_options->inputs = INPUT_UNIFORM;
+	p_options->replayFile = NULL;
+	p_options->coldCache = 0;
+	p_options->threads = 0;
+	p_options->replicateTables = 0;
+	p_options->accuracy = 0;
+	p_options->reference = REFERENCE_DOUBLE;
+	p_options->tableValues = SIN_LUT_VALUES_EXACT;
+	p_options->domain_min = 0.0;
+	p_options->domain_max = TWO_PI_DOUBLE;
+	p_options->samples = ACCURACY_DEFAULT_SAMPLES;
+
+	for( int idx = 1; idx < argc; idx++ )
+	{
+		const char * arg = argv[idx];
+
+		if( strcmp( arg, "--format=table" ) == 0 ) p_options->format = OUTPUT_TABLE;
+		else if( strcmp( arg, "--format=csv" ) == 0 ) p_options->format = OUTPUT_CSV;
+		else if( strcmp( arg, "--format=json" ) == 0 ) p_options->format = OUTPUT_JSON;
+		else if( strncmp( arg, "--baseline=", strlen( "--baseline=" ) ) == 0 ) p_options->baselineFile = arg + strlen( "--baseline=" );
+		else if( strncmp( arg, "--threshold=", strlen( "--threshold=" ) ) == 0 )
+		{
+			char * end;
+			p_options->regressionThreshold = strtod( arg + strlen( "--threshold=" ), &end );
+			if( ( *end != '\0' ) || ( p_options->regressionThreshold < 0.0 ) ) return -1;
+		}
+		else if( strncmp( arg, "--filter=", strlen( "--filter=" ) ) == 0 )
+		{
+			p_options->filter = arg + strlen( "--filter=" );
+			if( functionName_matches( "", p_options->filter ) < 0 ) return -1;
+		}
+		else if( strncmp( arg, "--iterations=", strlen( "--iterations=" ) ) == 0 )
+		{
+			if( parseUnsigned( arg + strlen( "--iterations=" ), &p_options->iterations ) != 0 ) return -1;
+			if( p_options->iterations == 0 ) return -1;
+		}
+		else if( strncmp( arg, "--seed=", strlen( "--seed=" ) ) == 0 )
+		{
+			if( parseUnsigned( arg + strlen( "--seed=" ), &p_options->seed ) != 0 ) return -1;
+			p_options->seedGiven = 1;
+		}
+		else if( strcmp( arg, "--list" ) == 0 ) p_options->list = 1;
+		else if( strcmp( arg, "--cold-cache" ) == 0 ) p_options->coldCache = 1;
+		else if( strcmp( arg, "--threads" ) == 0 ) p_options->threads = availableCPUs();
+		else if( strncmp( arg, "--threads=", strlen( "--threads=" ) ) == 0 )
+		{
+			if( parseUnsigned( arg + strlen( "--threads=" ), &p_options->threads ) != 0 ) return -1;
+			if( p_options->threads == 0 ) return -1;
+		}
+		else if( strcmp( arg, "--replicate-tables" ) == 0 ) p_options->replicateTables = 1;
+		else if( strcmp( arg, "--accuracy" ) == 0 ) p_options->accuracy = 1;
+		else if( strncmp( arg, "--reference=", strlen( "--reference=" ) ) == 0 )
+		{
+			if( referenceOracle_find( arg + strlen( "--reference=" ), &p_options->reference ) != 0 ) return -1;
+			if( !referenceOracle_supported( p_options->reference ) ) return -1;
+		}
+		else if( strncmp( arg, "--table-values=", strlen( "--table-values=" ) ) == 0 )
+		{
+			if( sin_LUT_findValues( arg + strlen( "--table-values=" ), &p_options->tableValues ) != 0 ) return -1;
+		}
+		else if( strncmp( arg, "--domain=", strlen( "--domain=" ) ) == 0 )
+		{
+			char * end;
+			p_options->domain_min = strtod( arg + strlen( "--domain=" ), &end );
+			if( *end != ':' ) return -1;
+			p_options->domain_max = strtod( end + 1, &end );
+			if( *end != '\0' ) return -1;
+			if( !isfinite( p_options->domain_min ) || !isfinite( p_options->domain_max ) ) return -1;
+			if( p_options->domain_min >= p_options->domain_max ) return -1;
+		}
+		else if( strncmp( arg, "--samples=", strlen( "--samples=" ) ) == 0 )
+		{
+			if( parseUnsigned( arg + strlen( "--samples=" ), &p_options->samples ) != 0 ) return -1;
+			if( p_options->samples == 0 ) return -1;
+		}
+		else if( strncmp( arg, "--inputs=", strlen( "--inputs=" ) ) == 0 )
+		{
+			if( inputDistribution_find( arg + strlen( "--inputs=" ), &p_options->inputs ) != 0 ) return -1;
+		}
+		else if( strncmp( arg, "--replay=", strlen( "--replay=" ) ) == 0 )
+		{
+			p_options->replayFile = arg + strlen( "--replay=" );
+			p_options->inputs = INPUT_REPLAY;
+		}
+		else return -1;
+	}
+
+	if( ( p_options->inputs == INPUT_REPLAY ) && ( p_options->replayFile == NULL ) ) return -1;
+	if( p_options->replicateTables && ( ( p_options->threads == 0 ) || p_options->accuracy ) ) return -1;
+
+	return 0;
+}
+
+// Build the list of functions to run from the registry, leaving out any whose names don't match "filter" (if there is one). The
+// list ends with an entry whose function_enum is NOT_ASSIGNED, like the fixed list this replaced, and has to be freed.
+//
+static sinLUT_implementation_t * createCodeUnderTest(const char * filter)
+{
+	size_t registered = sinLUT_registeredCount();
+	size_t count = 0;
+	sinLUT_implementation_t * codeUnderTest = (sinLUT_implementation_t *)calloc( registered + 1, sizeof( sinLUT_implementation_t ) );
+
+	if( codeUnderTest == NULL ) return NULL;
+
+	for( size_t idx = 0; idx < registered; idx++ )
+	{
+		const sinLUT_registration_t * p_registration = sinLUT_registered( idx );
+		sinLUT_implementation_t * p_CUT = &codeUnderTest[count];
+
+		if( ( filter != NULL ) && ( functionName_matches( p_registration->name, filter ) != 1 ) ) continue;
+
+		p_CUT->fcn_name = p_registration->name;
+		p_CUT->function_enum = p_registration->signature;
+		switch( p_registration->signature )
+		{
+			case fcn_flt_in_flt_out: p_CUT->fcn_float = p_registration->fcn_float; break;
+			case fcn_fxd_in_fxd_out: p_CUT->fcn_fixedPoint = p_registration->fcn_fixedPoint; break;
+			case fcn_dbl_arr_dbl_arr: p_CUT->fcn_double_batch = p_registration->fcn_double_batch; break;
+			case fcn_flt_arr_flt_arr: p_CUT->fcn_float_batch = p_registration->fcn_float_batch; break;
+			case fcn_fxd_arr_fxd_arr: p_CUT->fcn_fixedPoint_batch = p_registration->fcn_fixedPoint_batch; break;
+			default: p_CUT->fcn_double = p_registration->fcn_double; break;
+		}
+		p_CUT->kernel = p_registration->kernel;
+		p_CUT->errorBound = p_registration->errorBound;
+		p_CUT->memoryBytes = sinLUT_memoryBytes( p_registration );
+		memcpy( p_CUT->tables, p_registration->tables, sizeof( p_CUT->tables ) );
+		count++;
+	}
+
+	return codeUnderTest;
+}
+
+static const char * signatureName(fcnSignature_t signature)
+{
+	const char * ret = "unknown";
+
+	switch( signature )
+	{
+		case fcn_scaffolding: ret = "scaffolding"; break;
+		case fcn_dbl_in_dbl_out: ret = "double"; break;
+		case fcn_flt_in_flt_out: ret = "float"; break;
+		case fcn_fxd_in_fxd_out: ret = "q9.22->q0.31"; break;
+		case fcn_dbl_arr_dbl_arr: ret = "double[]"; break;
+		case fcn_flt_arr_flt_arr: ret = "float[]"; break;
+		case fcn_fxd_arr_fxd_arr: ret = "q9.22[]->q0.31[]"; break;
+		default: break;
+	}
+
+	return ret;
+}
+
+static void printList(const sinLUT_implementation_t codeUnderTest[])
+{
+	printf("Function\t%-14s%-18s%-14s%s\n", "Signature", "Kernel", "Error bound", "Memory (B)");
+	printf("----------------------------------------------------------------------------\n");
+
+	for( int idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		const sinLUT_implementation_t * p_CUT = &codeUnderTest[idx_CUT];
+
+		printf("%s\t%-14s%-10s%-8s%-14g%zu\n", p_CUT->fcn_name, signatureName( p_CUT->function_enum ),
+			sin_LUT_kernelName( p_CUT->kernel ), sin_LUT_kernelSupported( p_CUT->kernel ) ? "" : "(n/a)",
+			p_CUT->errorBound, p_CUT->memoryBytes);
+	}
+}
+
+// In scaling mode (--threads), each function is run on 1, 2, 4, ... threads at once, up to the number asked for, each thread
+// pinned to its own CPU and working through SCALING_REPEATS throughput blocks of its own. A function whose tables are shared
+// read-only should scale almost perfectly until the threads start competing for the shared caches or memory bandwidth.
+//
+#define SCALING_REPEATS 1000
+
+// The interpolated array LUTs, run on the table the calling thread was given, to compare every thread sharing the one table
+// against every thread reading a private copy (allocated and filled in by that thread, so that the OS puts it in memory local
+// to that thread's CPU).
+//
+static _Thread_local const double * p_threadTable_double;
+static _Thread_local const float * p_threadTable_float;
+
+static void sin_threadTable_double_batch(const double * restrict in, double * restrict out, size_t n)
+{
+	sin_LUT_double_interpolate_batch_table( p_threadTable_double, in, out, n );
+}
+
+static void sin_threadTable_float_batch(const float * restrict in, float * restrict out, size_t n)
+{
+	sin_LUT_float_interpolate_batch_table( p_threadTable_float, in, out, n );
+}
+
+typedef struct scalingRow_t
+{
+	sinLUT_implementation_t implementation;
+	int replicateTables;
+} scalingRow_t;
+
+static const scalingRow_t tableScaling_rows[] =
+{
+	{ { .fcn_name = "Dbl Tbl Shared", .function_enum = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_threadTable_double_batch }, 0 },
+	{ { .fcn_name = "Dbl Tbl Replica", .function_enum = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_threadTable_double_batch }, 1 },
+	{ { .fcn_name = "Flt Tbl Shared", .function_enum = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_threadTable_float_batch }, 0 },
+	{ { .fcn_name = "Flt Tbl Replica", .function_enum = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_threadTable_float_batch }, 1 },
+};
+
+// Shared by every thread; each one only touches its own entry in "pp_blocks", "pp_table_double" and "pp_table_float"
+//
+typedef struct scalingWork_t
+{
+	const sinLUT_implementation_t * p_CUT;
+	int replicateTables;
+	inputDistribution_t inputs;
+	uint64_t seed;
+	const double * p_replay;
+	size_t replay_size;
+	block_t ** pp_blocks;
+	double ** pp_table_double;
+	float ** pp_table_float;
+} scalingWork_t;
+
+// Each thread gets its own inputs (from its own generator, seeded with the run's seed plus the thread's number) and runs one
+// block untimed, so that its code and tables are in its caches before the timing starts.
+//
+static void scaling_setup(void * p_context, uint32_t thread)
+{
+	scalingWork_t * p_work = (scalingWork_t *)p_context;
+
+	p_work->pp_blocks[thread] = (block_t *)malloc( sizeof( block_t ) );
+	ASSERT( p_work->pp_blocks[thread] != NULL );
+
+	p_inputGenerator_t p_inputs = inputGenerator_create( p_work->inputs, p_work->seed + thread, p_work->p_replay, p_work->replay_size );
+	ASSERT( p_inputs != NULL );
+	fillBlockInputs( p_work->pp_blocks[thread], p_inputs );
+	inputGenerator_destroy( p_inputs );
+
+	p_threadTable_double = sin_LUT_double_table();
+	p_threadTable_float = sin_LUT_float_table();
+	p_work->pp_table_double[thread] = NULL;
+	p_work->pp_table_float[thread] = NULL;
+
+	if( p_work->replicateTables )
+	{
+		size_t entries = sin_LUT_tableSizes().uniform;
+
+		p_work->pp_table_double[thread] = (double *)malloc( entries * sizeof( double ) );
+		p_work->pp_table_float[thread] = (float *)malloc( entries * sizeof( float ) );
+		ASSERT( ( p_work->pp_table_double[thread] != NULL ) && ( p_work->pp_table_float[thread] != NULL ) );
+		memcpy( p_work->pp_table_double[thread], sin_LUT_double_table(), entries * sizeof( double ) );
+		memcpy( p_work->pp_table_float[thread], sin_LUT_float_table(), entries * sizeof( float ) );
+		p_threadTable_double = p_work->pp_table_double[thread];
+		p_threadTable_float = p_work->pp_table_float[thread];
+	}
+
+	runBlock( p_work->p_CUT, p_work->pp_blocks[thread] );
+}
+
+static void scaling_run(void * p_context, uint32_t thread)
+{
+	scalingWork_t * p_work = (scalingWork_t *)p_context;
+
+	for( int repeat = 0; repeat < SCALING_REPEATS; repeat++ )
+	{
+		runBlock( p_work->p_CUT, p_work->pp_blocks[thread] );
+		CLOBBER_MEMORY();
+	}
+}
+
+static void scaling_teardown(void * p_context, uint32_t thread)
+{
+	scalingWork_t * p_work = (scalingWork_t *)p_context;
+
+	free( p_work->pp_blocks[thread] );
+	free( p_work->pp_table_double[thread] );
+	free( p_work->pp_table_float[thread] );
+}
+
+// Run one function on 1, 2, 4, ... and finally "maxThreads" threads and print its aggregate throughput (in millions of look-ups
+// per second, across all threads) and its scaling efficiency, i.e. that throughput as a fraction of one thread's times the
+// number of threads. Returns 0 if every run could be started.
+//
+static errno_t runScaling(const sinLUT_implementation_t * p_CUT, int replicateTables, uint32_t maxThreads, const harnessOptions_t * p_options,
+	const double * p_replay, size_t replay_size)
+{
+	errno_t err = 0;
+	double singleThread_lookupsPerSecond = 0.0;
+	scalingWork_t work =
+	{
+		.p_CUT = p_CUT,
+		.replicateTables = replicateTables,
+		.inputs = p_options->inputs,
+		.seed = p_options->seed,
+		.p_replay = p_replay,
+		.replay_size = replay_size,
+		.pp_blocks = (block_t **)calloc( maxThreads, sizeof( block_t * ) ),
+		.pp_table_double = (double **)calloc( maxThreads, sizeof( double * ) ),
+		.pp_table_float = (float **)calloc( maxThreads, sizeof( float * ) ),
+	};
+	threadWork_t threadWork = { scaling_setup, scaling_run, scaling_teardown, &work };
+
+	ASSERT( ( work.pp_blocks != NULL ) && ( work.pp_table_double != NULL ) && ( work.pp_table_float != NULL ) );
+
+	uint32_t threads = 1;
+	while( 1 )
+	{
+		uint64_t elapsed_ns = 0;
+
+		err = runOnThreads( threads, &threadWork, &elapsed_ns );
+		if( err != 0 ) break;
+
+		double lookupsPerSecond = (double) threads * BLOCK_SIZE * SCALING_REPEATS * 1e9 / (double) elapsed_ns;
+		if( threads == 1 ) singleThread_lookupsPerSecond = lookupsPerSecond;
+
+		printf("%s\t%u\t%-14.2f%.2f\n", p_CUT->fcn_name, (unsigned) threads, lookupsPerSecond / 1e6,
+			lookupsPerSecond / ( threads * singleThread_lookupsPerSecond ));
+
+		if( threads == maxThreads ) break;
+		threads = ( threads * 2 < maxThreads ) ? threads * 2 : maxThreads;
+	}
+
+	free( work.pp_blocks );
+	free( work.pp_table_double );
+	free( work.pp_table_float );
+
+	return err;
+}
+
+// Sweep every function's error over the domain (see accuracy.h) and print it, followed by each function's histogram of ULP
+// errors (leaving out the empty bins). Returns 0 if every sweep could be run.
+//
+static errno_t runAccuracy(const sinLUT_implementation_t codeUnderTest[], const harnessOptions_t * p_options)
+{
+	errno_t err = 0;
+	accuracyConfig_t config =
+	{
+		.domain_min = p_options->domain_min,
+		.domain_max = p_options->domain_max,
+		.samples = p_options->samples,
+		.seed = p_options->seed,
+		.threads = ( p_options->threads > 0 ) ? p_options->threads : availableCPUs(),
+	};
+	int count = 0;
+
+	for( int idx = 0; codeUnderTest[idx].function_enum != NOT_ASSIGNED; idx++ ) count++;
+
+	accuracyResult_t * p_results = (accuracyResult_t *)calloc( ( count > 0 ) ? count : 1, sizeof( accuracyResult_t ) );
+	if( p_results == NULL ) return -1;
+
+	printf("Accuracy (domain [%g, %g); %lu stratified samples where not exhaustive; seed %lu; %s reference; %s tables; %u threads)\n",
+		config.domain_min, config.domain_max, (unsigned long) config.samples, (unsigned long) config.seed,
+		referenceOracle_name( p_options->reference ), sin_LUT_valuesName( sin_LUT_selectedValues() ), (unsigned) config.threads);
+	printf("Function\tInputs\t\t\tMax Abs Err\tWorst Input\t\tMax ULP Err\tWorst Input\t\tAvg Abs Err\tTime (s)\n");
+	printf("--------------------------------------------------------------------------------------------------------------------------------------------\n");
+
+	for( int idx = 0; ( idx < count ) && ( err == 0 ); idx++ )
+	{
+		const sinLUT_implementation_t * p_CUT = &codeUnderTest[idx];
+		const accuracyResult_t * p_result = &p_results[idx];
+
+		if( ( p_CUT->function_enum == fcn_scaffolding ) || ( p_CUT->function_enum == fcn_unsupported ) ) continue;
+
+		err = accuracy_sweep( p_CUT, &config, &p_results[idx] );
+		if( err != 0 ) break;
+
+		printf("%s\t%-12llu%-12s%-16.12f%-24.17g%-16.6g%-24.17g%-16.12f%.3f\n", p_CUT->fcn_name, (unsigned long long) p_result->inputs,
+			p_result->exhaustive ? "(all)" : "(sampled)", p_result->absoluteError_max, p_result->absoluteError_argmax,
+			p_result->ulpError_max, p_result->ulpError_argmax, p_result->absoluteError_avg, (double) p_result->elapsed_ns / 1e9);
+	}
+
+	for( int idx = 0; ( idx < count ) && ( err == 0 ); idx++ )
+	{
+		const accuracyResult_t * p_result = &p_results[idx];
+		double lower = 0.0;
+
+		if( p_result->inputs == 0 ) continue;
+
+		printf("\n%s\tULP error histogram\n", codeUnderTest[idx].fcn_name);
+		for( int bin = 0; bin < ACCURACY_HISTOGRAM_BINS; bin++ )
+		{
+			double upper = accuracyHistogram_binLimit( bin );
+
+			if( p_result->histogram[bin] > 0 )
+			{
+				char range[48];
+
+				snprintf( range, sizeof( range ), "[%g, %g)", lower, upper );
+				printf("\t%-28s%-16llu%.6f%%\n", range, (unsigned long long) p_result->histogram[bin],
+					100.0 * (double) p_result->histogram[bin] / (double) p_result->inputs);
+			}
+			lower = upper;
+		}
+	}
+
+	free( p_results );
+
+	return err;
+}
+
 int main(int argc, char * argv[])
 {
 	errno_t err = 0;
+	harnessOptions_t options;
+
+	if( parseOptions( argc, argv, &options ) != 0 )
+	{
+		printUsage( ( argc > 0 ) ? argv[0] : "sin_lut" );
+		return EXIT_FAILURE;
+	}
+
+	testIterations = options.iterations;
+	err = referenceOracle_select( options.reference );
+	ASSERT( err == 0 );
+	err = sin_LUT_selectValues( options.tableValues );
+	ASSERT( err == 0 );
+
+	sinLUT_implementation_t * codeUnderTest = createCodeUnderTest( options.filter );
+	ASSERT( codeUnderTest != NULL );
+
+	if( options.list )
+	{
+		printList( codeUnderTest );
+		free( codeUnderTest );
+		return EXIT_SUCCESS;
+	}
 
 	p_systemTime_t p_start = systemTime_create();
 	p_systemTime_t p_end = systemTime_create();
 
-	sinLUT_implementation_t codeUnderTest[] = 
-	{
-		{ "Scaffolding",	fcn_scaffolding,	{.fcn_double = NULL}, 										0, 0, 0, 0, 0, 0, 0 },
-		{ "Library Sin",	fcn_dbl_in_dbl_out,	{.fcn_double = sin}, 										0, 0, 0, 0, 0, 0, 0 },
-		{ "LUT Double",		fcn_dbl_in_dbl_out,	{.fcn_double = sin_LUT_double},								0, 0, 0, 0, 0, 0, 0 },
-		{ "LUT Float",		fcn_flt_in_flt_out,	{.fcn_float = sin_LUT_float},								0, 0, 0, 0, 0, 0, 0 },
-		{ "LUT Fxd Pt",		fcn_fxd_in_fxd_out,	{.fcn_fixedPoint = sin_LUT_fixedPoint},						0, 0, 0, 0, 0, 0, 0 },
-		{ "LUT Fxd Safe",	fcn_fxd_in_fxd_out,	{.fcn_fixedPoint = sin_LUT_fixedPoint_safe},				0, 0, 0, 0, 0, 0, 0 },
-		{ "Dbl Interp",		fcn_dbl_in_dbl_out,	{.fcn_double = sin_LUT_double_interpolate},					0, 0, 0, 0, 0, 0, 0 },
-		{ "Flt Interp",		fcn_flt_in_flt_out,	{.fcn_float = sin_LUT_float_interpolate},					0, 0, 0, 0, 0, 0, 0 },
-		{ "Fxd Interp",		fcn_fxd_in_fxd_out,	{.fcn_fixedPoint = sin_LUT_fixedPoint_interpolate},			0, 0, 0, 0, 0, 0, 0 },
-		{ "Fxd Intp Sf",	fcn_fxd_in_fxd_out,	{.fcn_fixedPoint = sin_LUT_fixedPoint_interpolate_safe},	0, 0, 0, 0, 0, 0, 0 },
-		{ "Dbl X/Y list",	fcn_dbl_in_dbl_out,	{.fcn_double = sin_LUT_double_nonUniform},					0, 0, 0, 0, 0, 0, 0 },
-		{ "Flt X/Y list",	fcn_flt_in_flt_out,	{.fcn_float = sin_LUT_float_nonUniform},					0, 0, 0, 0, 0, 0, 0 },
-		{ "Fxd X/Y list",	fcn_fxd_in_fxd_out,	{.fcn_fixedPoint = sin_LUT_fixedPoint_nonUniform},			0, 0, 0, 0, 0, 0, 0 },
-		{ "Fxd X/Y Safe",	fcn_fxd_in_fxd_out,	{.fcn_fixedPoint = sin_LUT_fixedPoint_nonUniform_safe},		0, 0, 0, 0, 0, 0, 0 },
-		{ "Sin_32\t",		fcn_flt_in_flt_out,	{.fcn_float = sin_32},										0, 0, 0, 0, 0, 0, 0 },
-		{ "Sin_52\t",		fcn_flt_in_flt_out,	{.fcn_float = sin_52},										0, 0, 0, 0, 0, 0, 0 },
-		{ "Sin_73\t",		fcn_dbl_in_dbl_out,	{.fcn_double = sin_73},										0, 0, 0, 0, 0, 0, 0 },
-		{ "Sin_121\t",		fcn_dbl_in_dbl_out,	{.fcn_double = sin_121},									0, 0, 0, 0, 0, 0, 0 },
-		{0}
-	};
+	// One buffer for the per-call timings, allocated up front and reused for every function, so that nothing is allocated
+	// while timing
+	//
+	uint32_t * p_samples = (uint32_t *)malloc( testIterations * sizeof( uint32_t ) );
 
 	// Check that p_start and p_end were allocated
 	//
 	ASSERT(p_start != NULL);
 	ASSERT(p_end != NULL);
+	ASSERT(p_samples != NULL);
 	
 	// Initialize the underlying hardware (if necessary)
 	//
 	initHardware();
 	init_sinLUT();
 
-	// Seed the pseudo-random number generator
+	// Seed the input generator from the current time unless a seed was given. Every function is given the same inputs (the
+	// generator starts over for each one), so that they can be compared input for input.
 	//
-	uint32_t time_ns;
-	err = elapsedSystemTime_ns(&time_ns);
-	ASSERT( err == 0 );
-	srand((unsigned) time_ns);
+	if( !options.seedGiven )
+	{
+		err = elapsedSystemTime_ns(&options.seed);
+		ASSERT( err == 0 );
+	}
+
+	double * p_replay = NULL;
+	size_t replay_size = 0;
+
+	if( options.inputs == INPUT_REPLAY )
+	{
+		err = readInputFile( options.replayFile, &p_replay, &replay_size );
+		if( err != 0 )
+		{
+			fprintf(stderr, "ERROR: Couldn't read inputs from \"%s\"\n", options.replayFile);
+			free( p_samples );
+			free( codeUnderTest );
+			return EXIT_FAILURE;
+		}
+	}
+
+	p_inputGenerator_t p_inputs = inputGenerator_create( options.inputs, options.seed, p_replay, replay_size );
+	ASSERT( p_inputs != NULL );
+
+	// The blocks are timed with the first BLOCK_SIZE inputs
+	//
+	fillBlockInputs( &block, p_inputs );
+
+	char inputsDescription[128];
+	snprintf( inputsDescription, sizeof( inputsDescription ), "%s, seed %lu, %s reference, %s tables", inputDistribution_name( options.inputs ),
+		(unsigned long) options.seed, referenceOracle_name( options.reference ), sin_LUT_valuesName( options.tableValues ) );
+
+	// Skip any vectorized kernels this CPU can't run
+	//
+	for( int idx_CUT = 0; codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED; idx_CUT++ )
+	{
+		if( !sin_LUT_kernelSupported( codeUnderTest[idx_CUT].kernel ) ) codeUnderTest[idx_CUT].function_enum = fcn_unsupported;
+	}
+
+	if( options.accuracy )
+	{
+		err = runAccuracy( codeUnderTest, &options );
+		if( err != 0 ) fprintf(stderr, "ERROR: Couldn't run the accuracy sweep\n");
+
+		free( p_samples );
+		inputGenerator_destroy( p_inputs );
+		free( p_replay );
+		free( codeUnderTest );
+
+		return ( err == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if( options.threads > 0 )
+	{
+		errno_t scalingErr = 0;
+
+		printf("Scaling (%s; %u CPUs available; %d look-ups per thread)\n", inputsDescription, (unsigned) availableCPUs(),
+			BLOCK_SIZE * SCALING_REPEATS);
+		printf("Function\tThreads\tMlookups/s    Efficiency\n");
+		printf("----------------------------------------------------\n");
+
+		for( int idx = 0; ( codeUnderTest[idx].function_enum != NOT_ASSIGNED ) && ( scalingErr == 0 ); idx++ )
+		{
+			if( codeUnderTest[idx].function_enum == fcn_unsupported ) continue;
+			scalingErr = runScaling( &codeUnderTest[idx], 0, options.threads, &options, p_replay, replay_size );
+		}
+
+		for( size_t idx = 0; options.replicateTables && ( idx < sizeof( tableScaling_rows ) / sizeof( tableScaling_rows[0] ) ) && ( scalingErr == 0 ); idx++ )
+		{
+			const scalingRow_t * p_row = &tableScaling_rows[idx];
+
+			if( ( options.filter != NULL ) && ( functionName_matches( p_row->implementation.fcn_name, options.filter ) != 1 ) ) continue;
+			scalingErr = runScaling( &p_row->implementation, p_row->replicateTables, options.threads, &options, p_replay, replay_size );
+		}
+
+		if( scalingErr != 0 ) fprintf(stderr, "ERROR: Couldn't start the threads\n");
+
+		free( p_samples );
+		inputGenerator_destroy( p_inputs );
+		free( p_replay );
+		free( codeUnderTest );
+
+		return ( scalingErr == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	// The array LUTs use the most inputs: BATCH_SIZE on every iteration, warm-up or not
+	//
+	referenceCache_t references;
+	referenceCache_fill( &references, p_inputs, (size_t)( warmupIterations + testIterations ) * BATCH_SIZE );
 
 	int idx_CUT = 0;
 	while( codeUnderTest[idx_CUT].function_enum != NOT_ASSIGNED )
 	{
-		for( int idx_test = 0; idx_test < testIterations; idx_test++ )
+		if( codeUnderTest[idx_CUT].function_enum == fcn_unsupported )
+		{
+			idx_CUT++;
+			continue;
+		}
+
+		inputGenerator_reset( p_inputs );
+
+		// Each iteration has to take exactly the inputs its references are cached for (see referenceCache_get): one for the
+		// scalar functions and BATCH_SIZE for the array LUTs, which don't use the scalar input at all
+		//
+		int isBatch = fcnSignature_isBatch( codeUnderTest[idx_CUT].function_enum );
+
+		for( int idx_test = -(int)warmupIterations; idx_test < (int)testIterations; idx_test++ )
 		{
 			// Generate inputs for all three types of functions (double, float, fixed-point)
 			//
-			double output_CUT, input_double = (double) rand() / (double) RAND_MAX * 2.0 * PI;
+			double output_CUT = 0, input_double = isBatch ? 0.0 : inputGenerator_next( p_inputs ), input_CUT = input_double;
 			float output_float, input_float = (float) input_double;
 			q0_31_t output_fixedPoint;
-			q9_22_t input_fixedPoint = TOFIX(input_double, 22);
+			q9_22_t input_fixedPoint = toFixedPointInput( input_double );
+			double input_batch_double[BATCH_SIZE], output_batch_double[BATCH_SIZE];
+			float input_batch_float[BATCH_SIZE], output_batch_float[BATCH_SIZE];
+			q9_22_t input_batch_fixedPoint[BATCH_SIZE];
+			q0_31_t output_batch_fixedPoint[BATCH_SIZE];
 
 			// Call the correct function with the correct input data type based on the fcnSignature_t enum
 			//
 			switch( codeUnderTest[idx_CUT].function_enum )
 			{
 				case fcn_scaffolding:
+					DO_NOT_OPTIMIZE( input_double );
 					err = getSystemTime(p_start);
 					ASSERT( err == 0 );
 					output_CUT = 0;
+					DO_NOT_OPTIMIZE( output_CUT );
 					err = getSystemTime(p_end);
 					ASSERT( err == 0 );
 				break;
 
 				case fcn_dbl_in_dbl_out:
+					DO_NOT_OPTIMIZE( input_double );
 					err = getSystemTime(p_start);
 					ASSERT( err == 0 );
 					output_CUT = codeUnderTest[idx_CUT].fcn_double( input_double );
+					DO_NOT_OPTIMIZE( output_CUT );
 					err = getSystemTime(p_end);
 					ASSERT( err == 0 );
 				break;
 
 				case fcn_flt_in_flt_out:
+					DO_NOT_OPTIMIZE( input_float );
 					err = getSystemTime(p_start);
 					ASSERT( err == 0 );
 					output_float = codeUnderTest[idx_CUT].fcn_float( input_float );
+					DO_NOT_OPTIMIZE( output_float );
 					err = getSystemTime(p_end);
 					ASSERT( err == 0 );
 					output_CUT = (double) output_float;
+					input_CUT = (double) input_float;
 				break;
 
 				case fcn_fxd_in_fxd_out:
+					DO_NOT_OPTIMIZE( input_fixedPoint );
 					err = getSystemTime(p_start);
 					ASSERT( err == 0 );
 					output_fixedPoint = codeUnderTest[idx_CUT].fcn_fixedPoint( input_fixedPoint );
+					DO_NOT_OPTIMIZE( output_fixedPoint );
 					err = getSystemTime(p_end);
 					ASSERT( err == 0 );
 					output_CUT = TOFLT(output_fixedPoint, 31);
+					input_CUT = TOFLT(input_fixedPoint, 22);
+				break;
+
+				case fcn_dbl_arr_dbl_arr:
+					inputGenerator_fill( p_inputs, input_batch_double, BATCH_SIZE );
+					CLOBBER_MEMORY();
+					err = getSystemTime(p_start);
+					ASSERT( err == 0 );
+					codeUnderTest[idx_CUT].fcn_double_batch( input_batch_double, output_batch_double, BATCH_SIZE );
+					CLOBBER_MEMORY();
+					err = getSystemTime(p_end);
+					ASSERT( err == 0 );
+				break;
+
+				case fcn_flt_arr_flt_arr:
+					for( int idx = 0; idx < BATCH_SIZE; idx++ ) input_batch_float[idx] = (float) inputGenerator_next( p_inputs );
+					CLOBBER_MEMORY();
+					err = getSystemTime(p_start);
+					ASSERT( err == 0 );
+					codeUnderTest[idx_CUT].fcn_float_batch( input_batch_float, output_batch_float, BATCH_SIZE );
+					CLOBBER_MEMORY();
+					err = getSystemTime(p_end);
+					ASSERT( err == 0 );
+				break;
+
+				case fcn_fxd_arr_fxd_arr:
+					for( int idx = 0; idx < BATCH_SIZE; idx++ ) input_batch_fixedPoint[idx] = toFixedPointInput( inputGenerator_next( p_inputs ) );
+					CLOBBER_MEMORY();
+					err = getSystemTime(p_start);
+					ASSERT( err == 0 );
+					codeUnderTest[idx_CUT].fcn_fixedPoint_batch( input_batch_fixedPoint, output_batch_fixedPoint, BATCH_SIZE );
+					CLOBBER_MEMORY();
+					err = getSystemTime(p_end);
+					ASSERT( err == 0 );
 				break;
 
 				default:
@@ -119,24 +1130,53 @@ int main(int argc, char * argv[])
 				break;
 			}			
 			
-			// Add most recent computation time to the running total
+			// Warmup iterations aren't recorded
 			//
-			codeUnderTest[idx_CUT].executionTime_ns += systemTimeDiff_ns(p_start, p_end);
+			if( idx_test < 0 ) continue;
 
-			// Add current absolute error to the running total
+			// Add most recent computation time and error to the running totals. The array LUTs count as one test iteration, so
+			// their time and error are averaged over the batch first.
 			//
-			double output_sin = sin( input_double );
-			double absoluteError = fabs( output_sin - output_CUT );
-			codeUnderTest[idx_CUT].absoluteError_sum += absoluteError;
-			if( absoluteError > codeUnderTest[idx_CUT].absoluteError_max ) codeUnderTest[idx_CUT].absoluteError_max = absoluteError;
+			p_samples[idx_test] = systemTimeDiff_ns(p_start, p_end);
 
-			// Add current percent error to the running total
-			//
-			double percentError;
-			double expected = fabs( output_sin );
-			if ( expected != 0 ) percentError = absoluteError / expected * 100.0;
-			else percentError = 100.0;
-			codeUnderTest[idx_CUT].percentError_sum += percentError;
+			switch( codeUnderTest[idx_CUT].function_enum )
+			{
+				case fcn_dbl_arr_dbl_arr:
+					codeUnderTest[idx_CUT].executionTime_ns += (double) systemTimeDiff_ns(p_start, p_end) / BATCH_SIZE;
+					for( int idx = 0; idx < BATCH_SIZE; idx++ )
+					{
+						long double reference = referenceCache_get( &references, fcn_dbl_arr_dbl_arr,
+							( (size_t)( idx_test + (int)warmupIterations ) * BATCH_SIZE ) + idx, input_batch_double[idx] );
+						addError( &codeUnderTest[idx_CUT], reference, output_batch_double[idx], 1.0 / BATCH_SIZE );
+					}
+				break;
+
+				case fcn_flt_arr_flt_arr:
+					codeUnderTest[idx_CUT].executionTime_ns += (double) systemTimeDiff_ns(p_start, p_end) / BATCH_SIZE;
+					for( int idx = 0; idx < BATCH_SIZE; idx++ )
+					{
+						long double reference = referenceCache_get( &references, fcn_flt_arr_flt_arr,
+							( (size_t)( idx_test + (int)warmupIterations ) * BATCH_SIZE ) + idx, (double) input_batch_float[idx] );
+						addError( &codeUnderTest[idx_CUT], reference, (double) output_batch_float[idx], 1.0 / BATCH_SIZE );
+					}
+				break;
+
+				case fcn_fxd_arr_fxd_arr:
+					codeUnderTest[idx_CUT].executionTime_ns += (double) systemTimeDiff_ns(p_start, p_end) / BATCH_SIZE;
+					for( int idx = 0; idx < BATCH_SIZE; idx++ )
+					{
+						long double reference = referenceCache_get( &references, fcn_fxd_arr_fxd_arr,
+							( (size_t)( idx_test + (int)warmupIterations ) * BATCH_SIZE ) + idx, TOFLT(input_batch_fixedPoint[idx], 22) );
+						addError( &codeUnderTest[idx_CUT], reference, TOFLT(output_batch_fixedPoint[idx], 31), 1.0 / BATCH_SIZE );
+					}
+				break;
+
+				default:
+					codeUnderTest[idx_CUT].executionTime_ns += systemTimeDiff_ns(p_start, p_end);
+					addError( &codeUnderTest[idx_CUT], referenceCache_get( &references, codeUnderTest[idx_CUT].function_enum,
+						(size_t)( idx_test + (int)warmupIterations ), input_CUT ), output_CUT, 1.0 );
+				break;
+			}
 		}
 
 		// Determine averages
@@ -145,12 +1185,52 @@ int main(int argc, char * argv[])
 		codeUnderTest[idx_CUT].absoluteError_avg = codeUnderTest[idx_CUT].absoluteError_sum / testIterations;
 		codeUnderTest[idx_CUT].percentError_avg = codeUnderTest[idx_CUT].percentError_sum / testIterations;
 
+		timingStats_compute( p_samples, testIterations, outlierTrimFraction, &codeUnderTest[idx_CUT].executionTime_stats );
+		if( fcnSignature_isBatch( codeUnderTest[idx_CUT].function_enum ) )
+		{
+			scaleTimingStats( &codeUnderTest[idx_CUT].executionTime_stats, 1.0 / BATCH_SIZE );
+		}
+
+		// The hardware counters only wrap the throughput run, so that they count the look-ups and (almost) nothing else
+		//
+		err = perfCounters_start();
+		ASSERT( err == 0 );
+		codeUnderTest[idx_CUT].throughput_ns = timeBlock_ns( &codeUnderTest[idx_CUT], BENCHMARK_THROUGHPUT );
+		err = perfCounters_stop( &codeUnderTest[idx_CUT].perfCounts );
+		ASSERT( err == 0 );
+		codeUnderTest[idx_CUT].perfCounts.lookups = (uint64_t)BLOCK_SIZE * BLOCK_REPEATS;
+		codeUnderTest[idx_CUT].latency_ns = timeBlock_ns( &codeUnderTest[idx_CUT], BENCHMARK_LATENCY );
+
+		// The warm calls go first, so that the tables start out in cache
+		//
+		codeUnderTest[idx_CUT].warmCall_ns = NAN;
+		codeUnderTest[idx_CUT].coldCall_ns = NAN;
+		if( options.coldCache )
+		{
+			codeUnderTest[idx_CUT].warmCall_ns = timeSingleCall_ns( &codeUnderTest[idx_CUT], 0, p_samples, testIterations );
+			codeUnderTest[idx_CUT].coldCall_ns = timeSingleCall_ns( &codeUnderTest[idx_CUT], 1, p_samples, testIterations );
+		}
+
 		idx_CUT++;
 	}
 
-	printResults_CUT(testIterations, codeUnderTest);
+	printResults_CUT(testIterations, inputsDescription, codeUnderTest, options.format);
+	referenceCache_free( &references );
+	free( p_samples );
+	inputGenerator_destroy( p_inputs );
+	free( p_replay );
 
-	return EXIT_SUCCESS;
-}
+	int ret = EXIT_SUCCESS;
 
-#pragma GCC pop_options
\ No newline at end of file
+	if( options.baselineFile != NULL )
+	{
+		int regressions = compareResults_baseline( options.baselineFile, options.regressionThreshold, codeUnderTest );
+
+		if( regressions < 0 ) fprintf(stderr, "ERROR: Couldn't read baseline \"%s\"\n", options.baselineFile);
+		if( regressions != 0 ) ret = EXIT_FAILURE;
+	}
+
+	free( codeUnderTest );
+
+	return ret;
+}
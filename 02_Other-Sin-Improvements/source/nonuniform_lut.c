@@ -0,0 +1,228 @@
+#include <math.h>
+#include <stdlib.h>
+#include "nonuniform_lut.h"
+#include "assert.h"
+
+// Number of doubles in a cache line. The Eytzinger array is aligned so that element 8*k starts a cache line; those 8 elements
+// are the great-grandchildren of element k, so prefetching them while comparing against element k keeps the search 3 levels
+// ahead of its loads.
+//
+#define DOUBLES_PER_CACHE_LINE 8
+#define CACHE_LINE_SIZE_BYTES ( DOUBLES_PER_CACHE_LINE * sizeof( double ) )
+
+typedef struct segment_t
+{
+	double x0;
+	double y0;
+	double slope;
+} segment_t;
+
+struct nonUniformLUT_double_t
+{
+	nonUniformSearch_t search;
+	size_t size;
+	double * x;
+	segment_t * segments;
+	size_t eytzinger_size;
+	double * eytzinger;
+	segment_t * eytzinger_segments;
+	void * eytzinger_allocation;
+};
+
+// Return the segment that ends at knot "idx_sorted" (i.e. the segment for inputs just below that knot), clamped the same way as
+// the searches below: there's no segment before the first knot, so inputs below it use segment 0, and inputs above the last
+// knot ("idx_sorted" == size) use the last segment.
+//
+static segment_t segmentBelow(p_nonUniformLUT_double_t this, size_t idx_sorted)
+{
+	size_t segment = ( idx_sorted == 0 ) ? 0 : ( idx_sorted - 1 );
+	size_t last_segment = this->size - 2;
+
+	return this->segments[ ( segment > last_segment ) ? last_segment : segment ];
+}
+
+// Fill "eytzinger" (1-indexed) with the sorted x-values in breadth-first order: the children of element k are elements 2k and
+// 2k+1. An in-order walk of that implicit tree visits the elements in sorted order, so that's how it's filled. The tree is
+// padded out to a full binary tree with +Inf so that every search takes the same number of steps. Alongside each knot goes the
+// segment just below it, since that's what a search ending on that knot needs; element 0 (where a search ends if every knot is
+// <= the input) gets the last segment. The recursion is only as deep as the tree (log2(size)).
+//
+static size_t buildEytzinger(p_nonUniformLUT_double_t this, size_t idx_sorted, size_t k)
+{
+	if( k <= this->eytzinger_size )
+	{
+		idx_sorted = buildEytzinger( this, idx_sorted, 2 * k );
+		this->eytzinger[k] = ( idx_sorted < this->size ) ? this->x[idx_sorted] : INFINITY;
+		this->eytzinger_segments[k] = segmentBelow( this, idx_sorted );
+		idx_sorted = buildEytzinger( this, idx_sorted + 1, ( 2 * k ) + 1 );
+	}
+
+	return idx_sorted;
+}
+
+p_nonUniformLUT_double_t nonUniformLUT_double_create(const double * x, const double * y, size_t size, nonUniformSearch_t search)
+{
+	ASSERT( x != NULL );
+	ASSERT( y != NULL );
+	ASSERT( size >= 2 );
+	ASSERT( size < UINT32_MAX );
+
+	p_nonUniformLUT_double_t this = (p_nonUniformLUT_double_t)calloc(1, sizeof(struct nonUniformLUT_double_t));
+	if( this == NULL ) return NULL;
+
+	// The smallest full binary tree (2^levels - 1 elements) that holds every knot
+	//
+	size_t eytzinger_size = 1;
+	while( eytzinger_size < size ) eytzinger_size = ( 2 * eytzinger_size ) + 1;
+
+	this->search = search;
+	this->size = size;
+	this->eytzinger_size = eytzinger_size;
+	this->x = (double *)malloc( size * sizeof( double ) );
+	this->segments = (segment_t *)malloc( size * sizeof( segment_t ) );
+	this->eytzinger_segments = (segment_t *)malloc( ( eytzinger_size + 1 ) * sizeof( segment_t ) );
+	this->eytzinger_allocation = malloc( ( ( eytzinger_size + 1 ) * sizeof( double ) ) + CACHE_LINE_SIZE_BYTES );
+
+	if( ( this->x == NULL ) || ( this->segments == NULL ) || ( this->eytzinger_segments == NULL ) ||
+		( this->eytzinger_allocation == NULL ) )
+	{
+		nonUniformLUT_double_destroy( this );
+		return NULL;
+	}
+
+	// Align the Eytzinger array to a cache line (see DOUBLES_PER_CACHE_LINE)
+	//
+	uintptr_t address = (uintptr_t)this->eytzinger_allocation;
+	address = ( address + CACHE_LINE_SIZE_BYTES - 1 ) & ~(uintptr_t)( CACHE_LINE_SIZE_BYTES - 1 );
+	this->eytzinger = (double *)address;
+
+	// As with the sin LUTs, the slopes are computed once here so that a look-up is just a search and a multiply-add. The last
+	// knot has no segment of its own; inputs past it use the last segment.
+	//
+	for( size_t idx = 0; idx < size; idx++ )
+	{
+		if( idx > 0 ) ASSERT( x[idx] > x[idx-1] );
+
+		this->x[idx] = x[idx];
+		this->segments[idx].x0 = x[idx];
+		this->segments[idx].y0 = y[idx];
+		this->segments[idx].slope = ( idx < ( size - 1 ) ) ? ( ( y[idx+1] - y[idx] ) / ( x[idx+1] - x[idx] ) ) : 0.0;
+	}
+
+	this->eytzinger[0] = INFINITY;
+	this->eytzinger_segments[0] = segmentBelow( this, size );
+	buildEytzinger( this, 0, 1 );
+
+	return this;
+}
+
+void nonUniformLUT_double_destroy(p_nonUniformLUT_double_t this)
+{
+	if( this == NULL ) return;
+
+	free( this->x );
+	free( this->segments );
+	free( this->eytzinger_segments );
+	free( this->eytzinger_allocation );
+	free( this );
+}
+
+// Each search returns the index of the segment containing "key": the last knot with x <= key, clamped to [0, size-2] so that
+// inputs outside the table are extrapolated from the first or last segment.
+//
+static inline size_t searchBinary(p_nonUniformLUT_double_t this, double key)
+{
+	const double * x = this->x;
+	size_t last_segment = this->size - 2;
+	size_t low = 0;
+	size_t high = last_segment;
+
+	if( key < x[0] ) return 0;
+
+	while( low < high )
+	{
+		size_t mid = ( low + high ) / 2;
+		if( key < x[mid] ) high = mid - 1;
+		else if( key >= x[mid+1] ) low = mid + 1;
+		else return mid;
+	}
+
+	return low;
+}
+
+static inline size_t searchBranchless(p_nonUniformLUT_double_t this, double key)
+{
+	size_t ret = nonUniform_searchBranchless_double( this->x, this->size, key );
+	size_t last_segment = this->size - 2;
+
+	return ( ret > last_segment ) ? last_segment : ret;
+}
+
+// Unlike the other two searches, this one returns the segment itself rather than its index, since the Eytzinger layout keeps
+// its own copy of the segments (see buildEytzinger).
+//
+static inline const segment_t * searchEytzinger(p_nonUniformLUT_double_t this, double key)
+{
+	const double * eytzinger = this->eytzinger;
+	size_t eytzinger_size = this->eytzinger_size;
+	size_t k = 1;
+
+	// Walk down the tree, going right whenever the knot is <= key. The tree is full, so this loop always runs once per level.
+	//
+	while( k <= eytzinger_size )
+	{
+		__builtin_prefetch( &eytzinger[ k * DOUBLES_PER_CACHE_LINE ] );
+		k = ( 2 * k ) + ( eytzinger[k] <= key );
+	}
+
+	// "k" has now walked off the bottom of the tree. Undoing the trailing right-turns (the trailing 1 bits), plus the left turn
+	// before them, gives the first knot that's > key; if every turn was to the right, there isn't one and k ends up 0.
+	//
+	k >>= __builtin_ffsl( (long)~k );
+
+	return &this->eytzinger_segments[k];
+}
+
+static inline double interpolate(const segment_t * segment, double x)
+{
+	return segment->y0 + ( segment->slope * ( x - segment->x0 ) );
+}
+
+double nonUniformLUT_double(p_nonUniformLUT_double_t this, double x)
+{
+	const segment_t * segment = &this->segments[0];
+
+	switch( this->search )
+	{
+		case NONUNIFORM_SEARCH_BINARY: segment = &this->segments[ searchBinary( this, x ) ]; break;
+		case NONUNIFORM_SEARCH_BRANCHLESS: segment = &this->segments[ searchBranchless( this, x ) ]; break;
+		case NONUNIFORM_SEARCH_EYTZINGER: segment = searchEytzinger( this, x ); break;
+		default: ASSERT( 0 ); break;
+	}
+
+	return interpolate( segment, x );
+}
+
+void nonUniformLUT_double_batch(p_nonUniformLUT_double_t this, const double * restrict in, double * restrict out, size_t n)
+{
+	// Pick the search once for the whole array, not once per element
+	//
+	switch( this->search )
+	{
+		case NONUNIFORM_SEARCH_BINARY:
+			for( size_t idx = 0; idx < n; idx++ ) out[idx] = interpolate( &this->segments[ searchBinary( this, in[idx] ) ], in[idx] );
+		break;
+
+		case NONUNIFORM_SEARCH_BRANCHLESS:
+			for( size_t idx = 0; idx < n; idx++ ) out[idx] = interpolate( &this->segments[ searchBranchless( this, in[idx] ) ], in[idx] );
+		break;
+
+		case NONUNIFORM_SEARCH_EYTZINGER:
+			for( size_t idx = 0; idx < n; idx++ ) out[idx] = interpolate( searchEytzinger( this, in[idx] ), in[idx] );
+		break;
+
+		default:
+			ASSERT( 0 );
+		break;
+	}
+}
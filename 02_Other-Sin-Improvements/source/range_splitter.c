@@ -0,0 +1,137 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include "range_splitter.h"
+#include "assert.h"
+
+// Each worker's range has its own lock, and is padded out to a cache line so that workers taking chunks from their own ranges
+// don't slow each other down. The locks are only ever held for a few instructions, so they spin. atomic_flag is the one
+// atomic type every target is guaranteed to support without a library (on the Cortex-M3 it's LDREXB/STREXB).
+//
+#define CACHE_LINE_BYTES 64
+
+typedef union workerRange_t
+{
+	struct
+	{
+		atomic_flag lock;
+		uint64_t begin;
+		uint64_t end;
+	};
+	char padding[CACHE_LINE_BYTES];
+} workerRange_t;
+
+struct rangeSplitter_t
+{
+	uint32_t workers;
+	uint64_t chunk;
+	workerRange_t * p_ranges;
+};
+
+static void lock(workerRange_t * p_range)
+{
+	while( atomic_flag_test_and_set_explicit( &p_range->lock, memory_order_acquire ) );
+}
+
+static void unlock(workerRange_t * p_range)
+{
+	atomic_flag_clear_explicit( &p_range->lock, memory_order_release );
+}
+
+p_rangeSplitter_t rangeSplitter_create(uint64_t begin, uint64_t end, uint32_t workers, uint64_t chunk)
+{
+	ASSERT( begin <= end );
+	ASSERT( workers > 0 );
+	ASSERT( chunk > 0 );
+
+	p_rangeSplitter_t this = (p_rangeSplitter_t)calloc(1, sizeof(struct rangeSplitter_t));
+	if( this == NULL ) return NULL;
+
+	this->p_ranges = (workerRange_t *)calloc( workers, sizeof( workerRange_t ) );
+	if( this->p_ranges == NULL )
+	{
+		free( this );
+		return NULL;
+	}
+
+	this->workers = workers;
+	this->chunk = chunk;
+
+	uint64_t share = ( end - begin ) / workers, extra = ( end - begin ) % workers;
+	for( uint32_t worker = 0; worker < workers; worker++ )
+	{
+		atomic_flag_clear( &this->p_ranges[worker].lock );
+		this->p_ranges[worker].begin = begin;
+		begin += share + ( ( worker < extra ) ? 1 : 0 );
+		this->p_ranges[worker].end = begin;
+	}
+
+	return this;
+}
+
+void rangeSplitter_destroy(p_rangeSplitter_t this)
+{
+	if( this == NULL ) return;
+
+	free( this->p_ranges );
+	free( this );
+}
+
+int rangeSplitter_next(p_rangeSplitter_t this, uint32_t worker, uint64_t * p_begin, uint64_t * p_end)
+{
+	ASSERT( this != NULL );
+	ASSERT( worker < this->workers );
+	ASSERT( ( p_begin != NULL ) && ( p_end != NULL ) );
+
+	workerRange_t * p_own = &this->p_ranges[worker];
+
+	while( 1 )
+	{
+		lock( p_own );
+		if( p_own->begin < p_own->end )
+		{
+			uint64_t remaining = p_own->end - p_own->begin;
+
+			*p_begin = p_own->begin;
+			*p_end = p_own->begin + ( ( remaining < this->chunk ) ? remaining : this->chunk );
+			p_own->begin = *p_end;
+			unlock( p_own );
+
+			return 1;
+		}
+		unlock( p_own );
+
+		// Out of work, so steal from the next worker along that has some. Only one lock is ever held at a time, so two workers
+		// stealing from each other can't deadlock. Whatever is stolen is briefly in neither range; if the other workers see
+		// every range empty then, they stop, which is fine, since this worker is about to do it.
+		//
+		uint64_t stolen_begin = 0, stolen_end = 0;
+
+		for( uint32_t offset = 1; ( offset < this->workers ) && ( stolen_begin == stolen_end ); offset++ )
+		{
+			workerRange_t * p_victim = &this->p_ranges[ ( worker + offset ) % this->workers ];
+
+			lock( p_victim );
+			uint64_t remaining = p_victim->end - p_victim->begin;
+			if( remaining > this->chunk )
+			{
+				stolen_begin = p_victim->begin + ( remaining / 2 );
+				stolen_end = p_victim->end;
+				p_victim->end = stolen_begin;
+			}
+			else if( remaining > 0 )
+			{
+				stolen_begin = p_victim->begin;
+				stolen_end = p_victim->end;
+				p_victim->begin = p_victim->end;
+			}
+			unlock( p_victim );
+		}
+
+		if( stolen_begin == stolen_end ) return 0;
+
+		lock( p_own );
+		p_own->begin = stolen_begin;
+		p_own->end = stolen_end;
+		unlock( p_own );
+	}
+}
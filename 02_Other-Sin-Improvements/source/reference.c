@@ -0,0 +1,97 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "reference.h"
+#include "assert.h"
+
+#if defined(HAVE_QUADMATH)
+#include <quadmath.h>
+#endif
+
+static referenceOracle_t selectedOracle = REFERENCE_DOUBLE;
+
+int referenceOracle_supported(referenceOracle_t oracle)
+{
+	int ret = 0;
+
+	switch( oracle )
+	{
+		case REFERENCE_DOUBLE:
+		case REFERENCE_LONG_DOUBLE:
+			ret = 1;
+		break;
+
+		case REFERENCE_FLOAT128:
+#if defined(HAVE_QUADMATH)
+			ret = 1;
+#endif
+		break;
+
+		default:
+		break;
+	}
+
+	return ret;
+}
+
+int referenceOracle_select(referenceOracle_t oracle)
+{
+	if( !referenceOracle_supported( oracle ) ) return -1;
+
+	selectedOracle = oracle;
+
+	return 0;
+}
+
+long double referenceSin(double radians)
+{
+	long double ret = 0.0L;
+
+	switch( selectedOracle )
+	{
+		case REFERENCE_DOUBLE:
+			ret = sin( radians );
+		break;
+
+		case REFERENCE_LONG_DOUBLE:
+			ret = sinl( radians );
+		break;
+
+#if defined(HAVE_QUADMATH)
+		case REFERENCE_FLOAT128:
+			ret = (long double) sinq( radians );
+		break;
+#endif
+
+		default:
+			ASSERT(0);
+		// Unreachable
+		break;
+	}
+
+	return ret;
+}
+
+static const char * oracleNames[NUM_REFERENCE_ORACLES] =
+{
+	"double", "long-double", "float128"
+};
+
+const char * referenceOracle_name(referenceOracle_t oracle)
+{
+	return ( oracle < NUM_REFERENCE_ORACLES ) ? oracleNames[oracle] : "unknown";
+}
+
+int referenceOracle_find(const char * name, referenceOracle_t * p_oracle)
+{
+	for( int idx = 0; idx < NUM_REFERENCE_ORACLES; idx++ )
+	{
+		if( strcmp( name, oracleNames[idx] ) == 0 )
+		{
+			*p_oracle = (referenceOracle_t)idx;
+			return 0;
+		}
+	}
+
+	return -1;
+}
@@ -1,16 +1,225 @@
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include "sin_lut.h"
+#include "sin_lut_tables.h"
+#include "sin_lut_registry.h"
+#include "range_reduction.h"
 #include "error.h"
 #include "assert.h"
 
-#define SIN_LUT_SIZE 404
 #define LAST_ELEMENT ( SIN_LUT_SIZE - 1 )
 
 // Sin look-up table using doubles and floats at integer steps of "radians * 64"
-static double sinTable_double[SIN_LUT_SIZE];
-static float sinTable_float[SIN_LUT_SIZE];
-static q0_31_t sinTable_fixedPoint[SIN_LUT_SIZE];
+double sinTable_double[SIN_LUT_SIZE];
+float sinTable_float[SIN_LUT_SIZE];
+q0_31_t sinTable_fixedPoint[SIN_LUT_SIZE];
+
+// The values the rounded (nearest-entry) LUTs return for each "cell" of inputs, [(idx - 0.5) / 64, (idx + 0.5) / 64). With
+// SIN_LUT_VALUES_EXACT these are the same as the tables above; with SIN_LUT_VALUES_MINIMAX they differ, since the best value
+// to return for a whole cell isn't the best value for an interpolation to pass through (see sin_LUT_selectValues).
+static double sinCells_double[SIN_LUT_SIZE];
+static float sinCells_float[SIN_LUT_SIZE];
+static q0_31_t sinCells_fixedPoint[SIN_LUT_SIZE];
+
+// The same tables as {y0, slope} pairs
+_Alignas( CACHE_LINE_SIZE ) pair_double_t sinPairs_double[SIN_LUT_SIZE];
+_Alignas( CACHE_LINE_SIZE ) pair_float_t sinPairs_float[SIN_LUT_SIZE];
+_Alignas( CACHE_LINE_SIZE ) pair_fixed_t sinPairs_fixedPoint[SIN_LUT_SIZE];
+
+// Quarter-wave sin LUTs: only [0, PI/2] is stored, at SIN_QUARTER_LUT_STEPS steps (plus the endpoint), and the other three
+// quadrants are rebuilt by symmetry. The number of steps has to be a power of 2 so that the quadrant can be read straight out
+// of the index bits. At the default of 128 steps, the step size (about 0.0123 radians) is a little smaller than that of the
+// full-period tables above (1/64 radians) with a third of the entries; at 512 steps, the tables take up about as much memory
+// as the full-period ones with 4 times the resolution.
+#ifndef SIN_QUARTER_LUT_STEPS_LOG2
+#define SIN_QUARTER_LUT_STEPS_LOG2 7
+#endif
+#define SIN_QUARTER_LUT_STEPS ( 1 << SIN_QUARTER_LUT_STEPS_LOG2 )
+#define SIN_QUARTER_LUT_SIZE ( SIN_QUARTER_LUT_STEPS + 1 )
+#define HALF_PI_DOUBLE 1.57079632679489661923
+#define SIN_QUARTER_LUT_SCALE ( SIN_QUARTER_LUT_STEPS / HALF_PI_DOUBLE )
+#define Q0_31_MAX ( 1.0 - ( 1.0 / 2147483648.0 ) )
+
+// The fixed-point index can reach 4*SIN_QUARTER_LUT_STEPS, which only fits in a q9_22_t while that's less than 512
+//
+_Static_assert( SIN_QUARTER_LUT_STEPS_LOG2 <= 9, "The fixed-point quarter-wave index needs more integer bits" );
+
+static double sinQuarter_double[SIN_QUARTER_LUT_SIZE];
+static float sinQuarter_float[SIN_QUARTER_LUT_SIZE];
+static q0_31_t sinQuarter_fixedPoint[SIN_QUARTER_LUT_SIZE];
+
+// Kernel dispatch for the interpolated array LUTs. The pointers start out at the portable versions, so the "_best" functions
+// are safe to call even before init_sinLUT runs.
+static p_sin_LUT_double_batch p_double_interpolate_batch = sin_LUT_double_interpolate_batch;
+static p_sin_LUT_float_batch p_float_interpolate_batch = sin_LUT_float_interpolate_batch;
+static sinLUT_kernel_t selectedKernel = SIN_LUT_KERNEL_SCALAR;
+static sinLUT_values_t selectedValues = SIN_LUT_VALUES_EXACT;
+
+int sin_LUT_kernelSupported(sinLUT_kernel_t kernel)
+{
+	int ret = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+	// __builtin_cpu_supports also checks that the OS saves the wider registers on a context switch, so a CPU with AVX-512 running
+	// under an OS that doesn't support it reports 0 here.
+	//
+	__builtin_cpu_init();
+
+	switch( kernel )
+	{
+		case SIN_LUT_KERNEL_SCALAR: ret = 1; break;
+		case SIN_LUT_KERNEL_SSE41: ret = __builtin_cpu_supports( "sse4.1" ); break;
+		case SIN_LUT_KERNEL_AVX2: ret = __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ); break;
+		case SIN_LUT_KERNEL_AVX512: ret = __builtin_cpu_supports( "avx512f" ); break;
+		default: ret = 0; break;
+	}
+#else
+	ret = ( kernel == SIN_LUT_KERNEL_SCALAR );
+#endif
+
+	return ret;
+}
+
+const char * sin_LUT_kernelName(sinLUT_kernel_t kernel)
+{
+	const char * ret = "unknown";
+
+	switch( kernel )
+	{
+		case SIN_LUT_KERNEL_SCALAR: ret = "scalar"; break;
+		case SIN_LUT_KERNEL_SSE41: ret = "SSE4.1"; break;
+		case SIN_LUT_KERNEL_AVX2: ret = "AVX2+FMA"; break;
+		case SIN_LUT_KERNEL_AVX512: ret = "AVX-512"; break;
+		default: break;
+	}
+
+	return ret;
+}
+
+sinLUT_tableSizes_t sin_LUT_tableSizes(void)
+{
+	sinLUT_tableSizes_t ret = { SIN_LUT_SIZE, SIN_QUARTER_LUT_SIZE, NONUNIFORM_0DOT007ERROR_SIZE };
+
+	return ret;
+}
+
+const double * sin_LUT_double_table(void)
+{
+	return sinTable_double;
+}
+
+const float * sin_LUT_float_table(void)
+{
+	return sinTable_float;
+}
+
+sinLUT_kernel_t sin_LUT_selectedKernel(void)
+{
+	return selectedKernel;
+}
+
+int sin_LUT_selectValues(sinLUT_values_t values)
+{
+	if( ( values != SIN_LUT_VALUES_EXACT ) && ( values != SIN_LUT_VALUES_MINIMAX ) ) return -1;
+
+	selectedValues = values;
+
+	return 0;
+}
+
+sinLUT_values_t sin_LUT_selectedValues(void)
+{
+	return selectedValues;
+}
+
+const char * sin_LUT_valuesName(sinLUT_values_t values)
+{
+	const char * ret = "unknown";
+
+	switch( values )
+	{
+		case SIN_LUT_VALUES_EXACT: ret = "exact"; break;
+		case SIN_LUT_VALUES_MINIMAX: ret = "minimax"; break;
+		default: break;
+	}
+
+	return ret;
+}
+
+int sin_LUT_findValues(const char * name, sinLUT_values_t * p_values)
+{
+	for( int idx = 0; idx < NUM_SIN_LUT_VALUES; idx++ )
+	{
+		if( strcmp( name, sin_LUT_valuesName( (sinLUT_values_t)idx ) ) == 0 )
+		{
+			*p_values = (sinLUT_values_t)idx;
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+static void selectKernels(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	if( sin_LUT_kernelSupported( SIN_LUT_KERNEL_AVX512 ) )
+	{
+		p_double_interpolate_batch = sin_LUT_double_interpolate_batch_avx512;
+		p_float_interpolate_batch = sin_LUT_float_interpolate_batch_avx512;
+		selectedKernel = SIN_LUT_KERNEL_AVX512;
+	}
+	else if( sin_LUT_kernelSupported( SIN_LUT_KERNEL_AVX2 ) )
+	{
+		p_double_interpolate_batch = sin_LUT_double_interpolate_batch_avx2;
+		p_float_interpolate_batch = sin_LUT_float_interpolate_batch_avx2;
+		selectedKernel = SIN_LUT_KERNEL_AVX2;
+	}
+	else if( sin_LUT_kernelSupported( SIN_LUT_KERNEL_SSE41 ) )
+	{
+		p_double_interpolate_batch = sin_LUT_double_interpolate_batch_sse41;
+		p_float_interpolate_batch = sin_LUT_float_interpolate_batch_sse41;
+		selectedKernel = SIN_LUT_KERNEL_SSE41;
+	}
+#endif
+}
+
+void sin_LUT_double_interpolate_batch_best(const double * restrict in, double * restrict out, size_t n)
+{
+	p_double_interpolate_batch( in, out, n );
+}
+
+void sin_LUT_float_interpolate_batch_best(const float * restrict in, float * restrict out, size_t n)
+{
+	p_float_interpolate_batch( in, out, n );
+}
+
+static void init_nonUniformSlopes(void);
+static void init_nonUniformBuckets(void);
+static void init_nonUniformScan(void);
+
+// Half the difference between the largest and smallest values of sin over [low, high], plus the smallest (i.e. the value
+// that's never more than half that range from any of them). The only places sin turns around in [0, 2*PI] are its peak at
+// PI/2 and its trough at 3*PI/2; everywhere else its extremes over an interval are at the ends.
+//
+static double sinMidrange(double low, double high)
+{
+	double max = fmax( sin( low ), sin( high ) );
+	double min = fmin( sin( low ), sin( high ) );
+
+	if( ( low <= HALF_PI_DOUBLE ) && ( HALF_PI_DOUBLE <= high ) ) max = 1.0;
+	if( ( low <= 3.0 * HALF_PI_DOUBLE ) && ( 3.0 * HALF_PI_DOUBLE <= high ) ) min = -1.0;
+
+	return 0.5 * ( max + min );
+}
+
+// A straight line between two points of sin that are "step" apart, centered on c, sags below sin(c) by sin(c)*(1 - cos(step/2))
+// in the middle (for sin(c) > 0; it bulges above it by as much for sin(c) < 0). Scaling every node by 2/(1 + cos(step/2))
+// moves it away from 0 by about half of that, so that the interpolation's error swings from -sag/2 at the nodes to +sag/2 in
+// the middle, instead of from 0 to sag.
+//
+#define MINIMAX_NODE_SCALE ( 2.0 / ( 1.0 + cos( UNIFORM_LUT_STEP / 2.0 ) ) )
 
 void init_sinLUT(void)
 {
@@ -18,21 +227,67 @@ void init_sinLUT(void)
 	{
 		double radians = ( (double) idx ) / 64.0;
 		double output_double = sin( radians );
+		double cell_double = output_double;
+
+		if( selectedValues == SIN_LUT_VALUES_MINIMAX )
+		{
+			double cell_low = fmax( radians - ( UNIFORM_LUT_STEP / 2.0 ), 0.0 );
+			double cell_high = fmin( radians + ( UNIFORM_LUT_STEP / 2.0 ), 4.0 * HALF_PI_DOUBLE );
+
+			// The last entry's cell starts past 2*PI, so no input ever rounds to it
+			//
+			if( cell_low < cell_high ) cell_double = sinMidrange( cell_low, cell_high );
+			output_double *= MINIMAX_NODE_SCALE;
+		}
+
+		// Neither the midrange nor the scaled node can reach +/-1 (there's no node at PI/2), but clamp them anyway, since 1.0
+		// is out of range for a q0_31_t
+		//
 		sinTable_double[idx] = output_double;
 		sinTable_float[idx] = (float) output_double;
-		sinTable_fixedPoint[idx] = TOFIX(output_double, 31);
+		sinTable_fixedPoint[idx] = TOFIX(fmax( fmin( output_double, Q0_31_MAX ), -Q0_31_MAX ), 31);
+		sinCells_double[idx] = cell_double;
+		sinCells_float[idx] = (float) cell_double;
+		sinCells_fixedPoint[idx] = TOFIX(fmax( fmin( cell_double, Q0_31_MAX ), -Q0_31_MAX ), 31);
 	}
-}
 
-double sin_LUT_double(double radians)
-{
-	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
-	// to a valid  value instead of throwing an error.
+	// The slopes are computed from the rounded table values (not from sin directly) so that the interleaved LUTs give exactly
+	// the same results as the regular ones.
 	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
-	
+	for( int idx = 0; idx < SIN_LUT_SIZE; idx++)
+	{
+		int last = ( idx == LAST_ELEMENT );
+		sinPairs_double[idx].y0 = sinTable_double[idx];
+		sinPairs_double[idx].slope = last ? 0.0 : ( sinTable_double[idx+1] - sinTable_double[idx] );
+		sinPairs_float[idx].y0 = sinTable_float[idx];
+		sinPairs_float[idx].slope = last ? 0.0f : ( sinTable_float[idx+1] - sinTable_float[idx] );
+		sinPairs_fixedPoint[idx].y0 = sinTable_fixedPoint[idx];
+		sinPairs_fixedPoint[idx].slope = last ? 0 : FSUB( sinTable_fixedPoint[idx+1], sinTable_fixedPoint[idx] );
+	}
 
+	// sin(PI/2) is exactly 1, which is just out of range for a q0_31_t (and so can't be negated for the lower half of the wave),
+	// so the last fixed-point entry is clamped to the largest value a q0_31_t can hold.
+	//
+	for( int idx = 0; idx < SIN_QUARTER_LUT_SIZE; idx++)
+	{
+		double output_double = sin( ( (double) idx ) / SIN_QUARTER_LUT_SCALE );
+		sinQuarter_double[idx] = output_double;
+		sinQuarter_float[idx] = (float) output_double;
+		sinQuarter_fixedPoint[idx] = TOFIX(fmin( output_double, Q0_31_MAX ), 31);
+	}
+
+	init_nonUniformSlopes();
+	init_nonUniformBuckets();
+	init_nonUniformScan();
+	selectKernels();
+}
+
+// Each LUT is split in two: a "_reduced" function that does the actual look-up, which expects "radians" to already be in the
+// range [0, 2*PI), and the public function, which wraps the input first. The "_reduced" functions are inlined into both the
+// scalar and the batch (array) versions of each LUT.
+//
+static inline double sin_LUT_double_reduced(double radians)
+{
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT). Round "radians" by adding 0.5 
 	// and truncating. In this manner, all values between radian.0 and radian.49 become radian.5 to radian.99 and are truncated 
 	// to radian (i.e. they are rounded down). However, all values between radian.5 and radian.99 become radian+1.0 to
@@ -40,17 +295,19 @@ double sin_LUT_double(double radians)
 	//
 	int idx = (int)( ( radians * 64 ) + 0.5 );
 	
-	return sinTable_double[ idx ];
+	return sinCells_double[ idx ];
 }
 
-float sin_LUT_float(float radians)
+double sin_LUT_double(double radians)
 {
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
 	// to a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
+	return sin_LUT_double_reduced( reduceRadians_double( radians ) );
+}
 
+static inline float sin_LUT_float_reduced(float radians)
+{
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT). Round "radians" by adding 0.5 
 	// and truncating. In this manner, all values between radian.0 and radian.49 become radian.5 to radian.99 and are truncated 
 	// to radian (i.e. they are rounded down). However, all values between radian.5 and radian.99 become radian+1.0 to
@@ -58,7 +315,15 @@ float sin_LUT_float(float radians)
 	//
 	int idx = (int)( ( radians * 64 ) + 0.5 );
 
-	return sinTable_float[ idx ];
+	return sinCells_float[ idx ];
+}
+
+float sin_LUT_float(float radians)
+{
+	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
+	// to a valid value instead of throwing an error.
+	//
+	return sin_LUT_float_reduced( reduceRadians_float( radians ) );
 }
 
 q0_31_t sin_LUT_fixedPoint_safe(q9_22_t radians)
@@ -66,22 +331,12 @@ q0_31_t sin_LUT_fixedPoint_safe(q9_22_t radians)
 	errno_t err = 0;
 	q9_22_t index = 0;
 	q9_22_t index_plus_half = 0;
-	q9_22_t TWO_PI_FXD = TOFIX( TWO_PI, 28 );
 	int rounded_index = 0;
 
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians to 
 	// a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI_FXD )
-	{
-		err = SAFE_FSUB( radians, TWO_PI_FXD, &radians );
-		ASSERT( err == 0 );
-	}
-	while( radians < 0 )
-	{
-		err = SAFE_FADD( radians, TWO_PI_FXD, &radians );
-		ASSERT( err == 0 );
-	}
+	radians = reduceRadians_fixedPoint( radians );
 
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT). Add 0.5 and then convert
 	// to int (i.e. "q31_0" format) in order to implement a basic rounding.
@@ -94,22 +349,15 @@ q0_31_t sin_LUT_fixedPoint_safe(q9_22_t radians)
 
 	rounded_index = FCONV( index_plus_half, 22, 0 );
 
-	return sinTable_fixedPoint[ rounded_index ];
+	return sinCells_fixedPoint[ rounded_index ];
 }
 
-q0_31_t sin_LUT_fixedPoint(q9_22_t radians)
+static inline q0_31_t sin_LUT_fixedPoint_reduced(q9_22_t radians)
 {
 	q9_22_t index = 0;
 	q9_22_t index_plus_half = 0;
-	q9_22_t TWO_PI_FXD = TOFIX( TWO_PI, 28 );
 	int rounded_index = 0;
 
-	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians to 
-	// a valid value instead of throwing an error.
-	//
-	while( radians >= TWO_PI_FXD ) radians = FSUB( radians, TWO_PI_FXD );
-	while( radians < 0 ) radians = FADD(radians, TWO_PI_FXD );
-
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT). Add 0.5 and then convert
 	// to int (i.e. "q31_0" format) in order to implement a basic rounding.
 	//
@@ -117,27 +365,29 @@ q0_31_t sin_LUT_fixedPoint(q9_22_t radians)
 	index_plus_half = FADD( index, TOFIX( 0.5, 22 ) );
 	rounded_index = FCONV( index_plus_half, 22, 0 );
 
-	return sinTable_fixedPoint[ rounded_index ];
+	return sinCells_fixedPoint[ rounded_index ];
 }
 
-double sin_LUT_double_interpolate(double radians)
+q0_31_t sin_LUT_fixedPoint(q9_22_t radians)
+{
+	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians to 
+	// a valid value instead of throwing an error.
+	//
+	return sin_LUT_fixedPoint_reduced( reduceRadians_fixedPoint( radians ) );
+}
+
+static inline double sin_LUT_double_interpolate_reduced_table(const double * table, double radians)
 {
 	double ret;
 	int x0, x1;
 
-	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
-	// to a valid  value instead of throwing an error.
-	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
-
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT).
 	//
 	double x = radians * 64;
 
 	// Get the indices for the array elements that are just below and just above "x" by type-casting to int (to get x0, the 
 	// below element) and then adding one (to get x1, the above element). We can safely do this without any bounds checking
-	// since, in the first step of this function, we ensured that our input was less than 2*PI and 2*PI*64 is only a litle
+	// since the input has already been wrapped to less than 2*PI and 2*PI*64 is only a litle
 	// over 402.12; in this manner, the most x0 and x1 will ever be is 402 and 403, which are still within the bounds of our
 	// array.
 	//
@@ -150,8 +400,8 @@ double sin_LUT_double_interpolate(double radians)
 	// offset. This algorithm constitutes one floating-point multiply and 3 floating-point additions/subtractions, and so is
 	// relatively fast.
 	//
-	double y0 = sinTable_double[ x0 ];
-	double slope = sinTable_double[ x1 ] - y0;
+	double y0 = table[ x0 ];
+	double slope = table[ x1 ] - y0;
 	double span = x - (double)( x0 );
 	double offset = slope * span;
 	ret = y0 + offset;
@@ -159,28 +409,46 @@ double sin_LUT_double_interpolate(double radians)
 	return ret;
 }
 
-typedef struct point_double_t
+static inline double sin_LUT_double_interpolate_reduced(double radians)
 {
-	double x;
-	double y;
-} point_double_t;
+	return sin_LUT_double_interpolate_reduced_table( sinTable_double, radians );
+}
 
-typedef struct point_float_t
+double sin_LUT_double_interpolate(double radians)
 {
-	float x;
-	float y;
-} point_float_t;
+	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
+	// to a valid value instead of throwing an error.
+	//
+	return sin_LUT_double_interpolate_reduced( reduceRadians_double( radians ) );
+}
+
+// Each element of a non-uniform LUT is a line segment: its starting point and the slope to the next element. The tables below
+// only list the points; init_sinLUT computes the slopes once so that the look-ups don't have to divide.
+//
+typedef struct segment_double_t
+{
+	double x0;
+	double y0;
+	double slope;
+} segment_double_t;
+
+typedef struct segment_float_t
+{
+	float x0;
+	float y0;
+	float slope;
+} segment_float_t;
 
-typedef struct point_fixed_t
+typedef struct segment_fixed_t
 {
-	q9_22_t x;
-	q0_31_t y;
-} point_fixed_t;
+	q9_22_t x0;
+	q0_31_t y0;
+	q0_31_t slope;
+} segment_fixed_t;
 
-#define NONUNIFORM_0DOT007ERROR_SIZE 25
 #define LAST_ELEMENT_0DOT007ERROR ( NONUNIFORM_0DOT007ERROR_SIZE - 1 )
 
-static point_double_t nonUniform_double_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE] = 
+static segment_double_t nonUniform_double_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE] = 
 {
 	{ 0.000000000000000000,  0.000000000000000000 },
 	{ 0.246907827863357000,	 0.244406737256656000 },
@@ -209,7 +477,7 @@ static point_double_t nonUniform_double_0dot007error[NONUNIFORM_0DOT007ERROR_SIZ
 	{ 6.283185307179590000,  0.000000000000000000 }
 };
 
-static point_float_t nonUniform_float_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE] = 
+static segment_float_t nonUniform_float_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE] = 
 {
 	{ 0.000000000000000000,  0.000000000000000000 },
 	{ 0.246907827863357000,	 0.244406737256656000 },
@@ -238,7 +506,7 @@ static point_float_t nonUniform_float_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE]
 	{ 6.283185307179590000,  0.000000000000000000 }
 };
 
-static point_fixed_t nonUniform_fixed_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE] = 
+static segment_fixed_t nonUniform_fixed_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE] = 
 {
 	{ TOFIX(0.000000000000000000, 22),  TOFIX(0.000000000000000000, 31) },
 	{ TOFIX(0.246907827863357000, 22),	TOFIX(0.244406737256656000, 31) },
@@ -267,63 +535,155 @@ static point_fixed_t nonUniform_fixed_0dot007error[NONUNIFORM_0DOT007ERROR_SIZE]
 	{ TOFIX(6.283185307179590000, 22),  TOFIX(0.000000000000000000, 31) }
 };
 
-double sin_LUT_double_nonUniform(double radians)
+static void init_nonUniformSlopes(void)
 {
-	double ret;
-	int low = 0;
-	int high = LAST_ELEMENT_0DOT007ERROR;
-	int mid = ( low + high ) / 2;
-
-	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
-	// to a valid value instead of throwing an error.
-	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
+	errno_t err = 0;
 
-	// Perform a binary search to find the LUT elements that will be used to interpolate the final value. Returns the last 
-	// list element if "radians" is greater than the last element.
+	// The last element has no next point; its slope is never used, since an input on or past its x-value returns its y-value.
 	//
-	while( low <= high )
+	for( int idx = 0; idx < LAST_ELEMENT_0DOT007ERROR; idx++ )
 	{
-		mid = ( low + high ) / 2;
-		if( ( radians > nonUniform_double_0dot007error[mid].x ) && ( radians < nonUniform_double_0dot007error[mid+1].x ) ) break;
-		if( radians < nonUniform_double_0dot007error[mid].x ) high = mid;
-		else low = mid;
+		segment_double_t * p_double = &nonUniform_double_0dot007error[idx];
+		p_double->slope = ( p_double[1].y0 - p_double[0].y0 ) / ( p_double[1].x0 - p_double[0].x0 );
+
+		segment_float_t * p_float = &nonUniform_float_0dot007error[idx];
+		p_float->slope = ( p_float[1].y0 - p_float[0].y0 ) / ( p_float[1].x0 - p_float[0].x0 );
+
+		// The "_safe" LUT relies on this division having been checked, so it uses the same checks as that LUT does.
+		//
+		q0_31_t rise = 0;
+		q9_22_t run = 0;
+		segment_fixed_t * p_fixed = &nonUniform_fixed_0dot007error[idx];
+
+		err = SAFE_FSUB( p_fixed[1].y0, p_fixed[0].y0, &rise );
+		ASSERT( err == 0 );
+
+		err = SAFE_FSUB( p_fixed[1].x0, p_fixed[0].x0, &run );
+		ASSERT( err == 0 );
+
+		err = SAFE_FDIVG( rise, run, 31, 22, 31, &p_fixed->slope );
+		ASSERT( err == 0 );
 	}
+}
 
-	// Set "ret" equal to the y value of the last table element if "mid" came out to be the last element. Otherwise, compute
-	// the linear interpolation.
-	//
-	if( mid == LAST_ELEMENT_0DOT007ERROR ) ret = nonUniform_double_0dot007error[mid].y;
-	else
+// Bucket indices for the non-uniform LUTs. Bucket "b" covers the inputs in [b, b+1) / NONUNIFORM_BUCKETS_PER_RADIAN and holds
+// the index of the segment that the start of that range falls in, so that a look-up can jump (almost) straight to the right
+// segment instead of searching for it. The bucket width is a power of 2 so that "radians * NONUNIFORM_BUCKETS_PER_RADIAN" is
+// exact in every data type, and it's narrower than the closest pair of x-values (about 0.24 radians apart) so that no bucket
+// contains more than one x-value. One set of buckets per data type, since their x-values round slightly differently.
+//
+#define NONUNIFORM_BUCKETS_PER_RADIAN 8
+#define NONUNIFORM_0DOT007ERROR_BUCKETS 51 // ceil( 2*PI * NONUNIFORM_BUCKETS_PER_RADIAN )
+
+static uint8_t bucket_double_0dot007error[NONUNIFORM_0DOT007ERROR_BUCKETS];
+static uint8_t bucket_float_0dot007error[NONUNIFORM_0DOT007ERROR_BUCKETS];
+static uint8_t bucket_fixed_0dot007error[NONUNIFORM_0DOT007ERROR_BUCKETS];
+
+static void init_nonUniformBuckets(void)
+{
+	int idx_double = 0, idx_float = 0, idx_fixed = 0;
+
+	for( int bucket = 0; bucket < NONUNIFORM_0DOT007ERROR_BUCKETS; bucket++ )
 	{
-		// Compute the linear interpolation. The slope is the standard "rise" over "run". The "span" is the difference 
-		// between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a result of our 
-		// span. The final value is equal to the y-value of the lower point plus this offset.
+		double start = (double) bucket / NONUNIFORM_BUCKETS_PER_RADIAN;
+		double end = (double)( bucket + 1 ) / NONUNIFORM_BUCKETS_PER_RADIAN;
+
+		while( nonUniform_double_0dot007error[idx_double+1].x0 <= start ) idx_double++;
+		while( nonUniform_float_0dot007error[idx_float+1].x0 <= (float) start ) idx_float++;
+		while( nonUniform_fixed_0dot007error[idx_fixed+1].x0 <= TOFIX( start, 22 ) ) idx_fixed++;
+
+		bucket_double_0dot007error[bucket] = (uint8_t) idx_double;
+		bucket_float_0dot007error[bucket] = (uint8_t) idx_float;
+		bucket_fixed_0dot007error[bucket] = (uint8_t) idx_fixed;
+
+		// The look-ups only step forward by one segment, so the NEXT segment has to reach the end of this bucket. (The last
+		// bucket extends past 2*PI, where there are no more segments; inputs never get that far.)
 		//
-		double x0 = nonUniform_double_0dot007error[mid].x;
-		double y0 = nonUniform_double_0dot007error[mid].y;
-		double rise = nonUniform_double_0dot007error[mid+1].y - y0;
-		double run = nonUniform_double_0dot007error[mid+1].x - x0;
-		double slope = rise / run;
-		double span = radians - x0;
-		double offset = slope * span;
-		ret = y0 + offset;
+		if( idx_double < LAST_ELEMENT_0DOT007ERROR - 1 ) ASSERT( nonUniform_double_0dot007error[idx_double+2].x0 >= end );
+		if( idx_float < LAST_ELEMENT_0DOT007ERROR - 1 ) ASSERT( nonUniform_float_0dot007error[idx_float+2].x0 >= (float) end );
+		if( idx_fixed < LAST_ELEMENT_0DOT007ERROR - 1 ) ASSERT( nonUniform_fixed_0dot007error[idx_fixed+2].x0 >= TOFIX( end, 22 ) );
 	}
+}
 
-	return ret;
+nonUniformScan_float_t nonUniformScan_float_0dot007error;
+
+_Static_assert( NONUNIFORM_0DOT007ERROR_SIZE <= NONUNIFORM_SCAN_SIZE, "The scan table is too small for the non-uniform LUT" );
+
+static void init_nonUniformScan(void)
+{
+	for( int idx = 0; idx < NONUNIFORM_SCAN_SIZE; idx++ )
+	{
+		if( idx < NONUNIFORM_0DOT007ERROR_SIZE )
+		{
+			nonUniformScan_float_0dot007error.x0[idx] = nonUniform_float_0dot007error[idx].x0;
+			nonUniformScan_float_0dot007error.y0[idx] = nonUniform_float_0dot007error[idx].y0;
+			nonUniformScan_float_0dot007error.slope[idx] = nonUniform_float_0dot007error[idx].slope;
+		}
+		else
+		{
+			nonUniformScan_float_0dot007error.x0[idx] = INFINITY;
+			nonUniformScan_float_0dot007error.y0[idx] = 0.0f;
+			nonUniformScan_float_0dot007error.slope[idx] = 0.0f;
+		}
+	}
 }
 
-float sin_LUT_float_interpolate(float radians)
+// The uniform LUTs are listed first (the interpolated ones change entries at multiples of 1/64 and the rounded ones half way in
+// between, so together that's every multiple of 1/128), then the quarter-wave LUTs over all four quadrants (likewise, every
+// half step), then the non-uniform LUTs' x-values.
+//
+#define UNIFORM_BOUNDARIES ( 2 * SIN_LUT_SIZE )
+#define QUARTER_BOUNDARIES ( 8 * SIN_QUARTER_LUT_STEPS )
+
+size_t sin_LUT_boundaryCount(void)
 {
-	float ret;
-	int x0, x1;
+	return UNIFORM_BOUNDARIES + QUARTER_BOUNDARIES + NONUNIFORM_0DOT007ERROR_SIZE;
+}
+
+double sin_LUT_boundary(size_t idx)
+{
+	ASSERT( idx < sin_LUT_boundaryCount() );
+
+	if( idx < UNIFORM_BOUNDARIES ) return (double) idx / 128.0;
+	idx -= UNIFORM_BOUNDARIES;
 
+	if( idx < QUARTER_BOUNDARIES ) return (double) idx * ( HALF_PI_DOUBLE / ( 2 * SIN_QUARTER_LUT_STEPS ) );
+	idx -= QUARTER_BOUNDARIES;
+
+	return nonUniform_double_0dot007error[idx].x0;
+}
+
+static inline double sin_LUT_double_nonUniform_reduced(double radians)
+{
+	// Look up the segment that the start of this input's bucket falls in. No bucket contains more than one x-value (see
+	// init_nonUniformBuckets), so the input is either in that segment or the next one. The wrap guarantees that "radians" is
+	// below the last x-value, so the last element is never selected and its "next" element is never read.
+	//
+	int idx = bucket_double_0dot007error[ (int)( radians * NONUNIFORM_BUCKETS_PER_RADIAN ) ];
+	idx += ( radians >= nonUniform_double_0dot007error[idx+1].x0 );
+
+	// Compute the linear interpolation. The slope (the standard "rise" over "run") was computed by init_sinLUT. The "span"
+	// is the difference between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a
+	// result of our span. The final value is equal to the y-value of the lower point plus this offset.
+	//
+	double span = radians - nonUniform_double_0dot007error[idx].x0;
+	double offset = nonUniform_double_0dot007error[idx].slope * span;
+
+	return nonUniform_double_0dot007error[idx].y0 + offset;
+}
+
+double sin_LUT_double_nonUniform(double radians)
+{
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
-	// to a valid  value instead of throwing an error.
+	// to a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
+	return sin_LUT_double_nonUniform_reduced( reduceRadians_double( radians ) );
+}
+
+static inline float sin_LUT_float_interpolate_reduced_table(const float * table, float radians)
+{
+	float ret;
+	int x0, x1;
 
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT).
 	//
@@ -331,7 +691,7 @@ float sin_LUT_float_interpolate(float radians)
 
 	// Get the indices for the array elements that are just below and just above "x" by type-casting to int (to get x0, the 
 	// below element) and then adding one (to get x1, the above element). We can safely do this without any bounds checking
-	// since, in the first step of this function, we ensured that our input was less than 2*PI and 2*PI*64 is only a litle
+	// since the input has already been wrapped to less than 2*PI and 2*PI*64 is only a litle
 	// over 402.12; in this manner, the most x0 and x1 will ever be is 402 and 403, which are still within the bounds of our
 	// array.
 	//
@@ -344,8 +704,8 @@ float sin_LUT_float_interpolate(float radians)
 	// offset. This algorithm constitutes one floating-point multiply and 3 floating-point additions/subtractions, and so is
 	// relatively fast.
 	//
-	float y0 = sinTable_float[ x0 ];
-	float slope = sinTable_float[ x1 ] - y0;
+	float y0 = table[ x0 ];
+	float slope = table[ x1 ] - y0;
 	float span = x - (float)( x0 );
 	float offset = slope * span;
 	ret = y0 + offset;
@@ -353,51 +713,64 @@ float sin_LUT_float_interpolate(float radians)
 	return ret;
 }
 
-float sin_LUT_float_nonUniform(float radians)
+static inline float sin_LUT_float_interpolate_reduced(float radians)
 {
-	float ret;
-	int low = 0;
-	int high = LAST_ELEMENT_0DOT007ERROR;
-	int mid = ( low + high ) / 2;
+	return sin_LUT_float_interpolate_reduced_table( sinTable_float, radians );
+}
 
+float sin_LUT_float_interpolate(float radians)
+{
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
 	// to a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI ) radians -= TWO_PI;
-	while( radians < 0 ) radians += TWO_PI;
+	return sin_LUT_float_interpolate_reduced( reduceRadians_float( radians ) );
+}
+
+static inline float sin_LUT_float_nonUniform_reduced(float radians)
+{
+	// Look up the segment that the start of this input's bucket falls in. No bucket contains more than one x-value (see
+	// init_nonUniformBuckets), so the input is either in that segment or the next one. The wrap guarantees that "radians" is
+	// below the last x-value, so the last element is never selected and its "next" element is never read.
+	//
+	int idx = bucket_float_0dot007error[ (int)( radians * NONUNIFORM_BUCKETS_PER_RADIAN ) ];
+	idx += ( radians >= nonUniform_float_0dot007error[idx+1].x0 );
 
-	// Perform a binary search to find the LUT elements that will be used to interpolate the final value. Returns the last 
-	// list element if "radians" is greater than the last element.
+	// Compute the linear interpolation. The slope (the standard "rise" over "run") was computed by init_sinLUT. The "span"
+	// is the difference between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a
+	// result of our span. The final value is equal to the y-value of the lower point plus this offset.
 	//
-	while( low <= high )
-	{
-		mid = ( low + high ) / 2;
-		if( ( radians > nonUniform_float_0dot007error[mid].x ) && ( radians < nonUniform_float_0dot007error[mid+1].x ) ) break;
-		if( radians < nonUniform_float_0dot007error[mid].x ) high = mid;
-		else low = mid;
-	}
+	float span = radians - nonUniform_float_0dot007error[idx].x0;
+	float offset = nonUniform_float_0dot007error[idx].slope * span;
+
+	return nonUniform_float_0dot007error[idx].y0 + offset;
+}
 
-	// Set "ret" equal to the y value of the last table element if "mid" came out to be the last element. Otherwise, compute
-	// the linear interpolation.
+float sin_LUT_float_nonUniform(float radians)
+{
+	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
+	// to a valid value instead of throwing an error.
 	//
-	if( mid == LAST_ELEMENT_0DOT007ERROR ) ret = nonUniform_float_0dot007error[mid].y;
-	else
-	{
-		// Compute the linear interpolation. The slope is the standard "rise" over "run". The "span" is the difference 
-		// between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a result of our 
-		// span. The final value is equal to the y-value of the lower point plus this offset.
-		//
-		float x0 = nonUniform_float_0dot007error[mid].x;
-		float y0 = nonUniform_float_0dot007error[mid].y;
-		float rise = nonUniform_float_0dot007error[mid+1].y - y0;
-		float run = nonUniform_float_0dot007error[mid+1].x - x0;
-		float slope = rise / run;
-		float span = radians - x0;
-		float offset = slope * span;
-		ret = y0 + offset;
-	}
+	return sin_LUT_float_nonUniform_reduced( reduceRadians_float( radians ) );
+}
 
-	return ret;
+static inline float sin_LUT_float_nonUniform_scan_reduced(float radians)
+{
+	// Compare "radians" against every x-value and count how many it's >= to. The x-values are sorted, so that count, minus one,
+	// is the segment "radians" falls in. There are no branches and every load is independent of the others, so the compiler can
+	// turn this loop into a handful of vector compares. The first x-value is 0, so the count is always at least one.
+	//
+	int idx = -1;
+	for( int k = 0; k < NONUNIFORM_SCAN_SIZE; k++ ) idx += ( radians >= nonUniformScan_float_0dot007error.x0[k] );
+
+	float span = radians - nonUniformScan_float_0dot007error.x0[idx];
+	float offset = nonUniformScan_float_0dot007error.slope[idx] * span;
+
+	return nonUniformScan_float_0dot007error.y0[idx] + offset;
+}
+
+float sin_LUT_float_nonUniform_scan(float radians)
+{
+	return sin_LUT_float_nonUniform_scan_reduced( reduceRadians_float( radians ) );
 }
 
 q0_31_t sin_LUT_fixedPoint_interpolate_safe(q9_22_t radians)
@@ -409,22 +782,12 @@ q0_31_t sin_LUT_fixedPoint_interpolate_safe(q9_22_t radians)
 	q0_31_t ret = 0;
 	q9_22_t x = 0;
 	q9_22_t span = 0;
-	q9_22_t TWO_PI_FXD = TOFIX(TWO_PI, 22);
 	int x0, x1;
 
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians to 
 	// a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI_FXD )
-	{
-		err = SAFE_FSUB( radians, TWO_PI_FXD, &radians );
-		ASSERT( err == 0 );
-	}
-	while( radians < 0 )
-	{
-		err = SAFE_FADD( radians, TWO_PI_FXD, &radians );
-		ASSERT( err == 0 );
-	}
+	radians = reduceRadians_fixedPoint( radians );
 
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT).
 	//
@@ -466,23 +829,15 @@ q0_31_t sin_LUT_fixedPoint_interpolate_safe(q9_22_t radians)
 	return ret;
 }
 
-q0_31_t sin_LUT_fixedPoint_interpolate(q9_22_t radians)
+static inline q0_31_t sin_LUT_fixedPoint_interpolate_reduced(q9_22_t radians)
 {
-	q9_22_t TWO_PI_FXD = TOFIX(TWO_PI, 22);
-
-	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians to 
-	// a valid value instead of throwing an error.
-	//
-	while( radians >= TWO_PI_FXD ) radians = FSUB( radians, TWO_PI_FXD );
-	while( radians < 0 ) radians = FADD( radians, TWO_PI_FXD );
-
 	// Multiply "radians" by 64 to map the range [0,2*PI] to the range [0,403] (the size of our LUT).
 	//
 	q9_22_t x = FMULI( radians, 64 );
 
 	// Get the indices for the array elements that are just below and just above "x" by converting from q16 to q0 (to get x0, 
 	// the below element) and then adding one (to get x1, the above element). We can safely do this without any bounds checking
-	// since, in the first step of this function, we ensured that our input was less than 2*PI and 2*PI*64 is only a litle
+	// since the input has already been wrapped to less than 2*PI and 2*PI*64 is only a litle
 	// over 402.12; in this manner, the most x0 and x1 will ever be is 402 and 403, which are still within the bounds of our
 	// array.
 	//
@@ -508,6 +863,14 @@ q0_31_t sin_LUT_fixedPoint_interpolate(q9_22_t radians)
 	return ret;
 }
 
+q0_31_t sin_LUT_fixedPoint_interpolate(q9_22_t radians)
+{
+	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians to 
+	// a valid value instead of throwing an error.
+	//
+	return sin_LUT_fixedPoint_interpolate_reduced( reduceRadians_fixedPoint( radians ) );
+}
+
 q0_31_t sin_LUT_fixedPoint_nonUniform_safe(q9_22_t radians)
 {
 	// The input doesn't necessarily need to be in q9_22 format, since the x-values never go over 2*PI. However, I'm using it here
@@ -515,128 +878,526 @@ q0_31_t sin_LUT_fixedPoint_nonUniform_safe(q9_22_t radians)
 	// already require an input parameter of at least q9_22).
 
 	errno_t err = 0;
-	q9_22_t x0 = 0;
-	q9_22_t run = 0;
+	q9_22_t bucket = 0;
 	q9_22_t span = 0;
-	q0_31_t y0 = 0;
-	q0_31_t rise = 0;
-	q0_31_t slope = 0;
 	q0_31_t offset = 0;
 	q0_31_t ret = 0;
-	q9_22_t TWO_PI_FXD = TOFIX(TWO_PI, 28);
-	int low = 0;
-	int high = LAST_ELEMENT_0DOT007ERROR;
-	int mid = ( low + high ) / 2;
+	int idx = 0;
+
+	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
+	// to a valid value instead of throwing an error.
+	//
+	radians = reduceRadians_fixedPoint( radians );
+
+	// Look up the segment that the start of this input's bucket falls in. No bucket contains more than one x-value (see
+	// init_nonUniformBuckets), so the input is either in that segment or the next one. The wrap guarantees that "radians" is
+	// below the last x-value, so the last element is never selected and its "next" element is never read.
+	//
+	err = SAFE_FMULI( radians, NONUNIFORM_BUCKETS_PER_RADIAN, &bucket );
+	ASSERT( err == 0 );
+
+	idx = bucket_fixed_0dot007error[ FCONV( bucket, 22, 0 ) ];
+	idx += ( radians >= nonUniform_fixed_0dot007error[idx+1].x0 );
+
+	// Compute the linear interpolation. The slope (the standard "rise" over "run") was computed, and checked for overflow, by
+	// init_sinLUT. The "span" is the difference between our input and the lower table point, x0. The "offset" is the amount our
+	// y-value changes as a result of our span. The final value is equal to the y-value of the lower point plus this offset.
+	//
+	err = SAFE_FSUB( radians, nonUniform_fixed_0dot007error[idx].x0, &span );
+	ASSERT( err == 0 );
+
+	err = SAFE_FMULG( nonUniform_fixed_0dot007error[idx].slope, span, 31, 22, 31, &offset );
+	ASSERT( err == 0 );
 
+	err = SAFE_FADD( nonUniform_fixed_0dot007error[idx].y0, offset, &ret );
+	ASSERT( err == 0 );
+
+	return ret;
+}
+
+static inline q0_31_t sin_LUT_fixedPoint_nonUniform_reduced(q9_22_t radians)
+{
+	// The input doesn't necessarily need to be in q9_22 format, since the x-values never go over 2*PI. However, I'm using it here
+	// to avoid needing to rewrite the rest of the test code to accept a fourth function signature (the first two fixed-point LUTs
+	// already require an input parameter of at least q9_22).
+
+	// Look up the segment that the start of this input's bucket falls in. No bucket contains more than one x-value (see
+	// init_nonUniformBuckets), so the input is either in that segment or the next one. The wrap guarantees that "radians" is
+	// below the last x-value, so the last element is never selected and its "next" element is never read.
+	//
+	int idx = bucket_fixed_0dot007error[ FCONV( FMULI( radians, NONUNIFORM_BUCKETS_PER_RADIAN ), 22, 0 ) ];
+	idx += ( radians >= nonUniform_fixed_0dot007error[idx+1].x0 );
+
+	// Compute the linear interpolation. The slope (the standard "rise" over "run") was computed by init_sinLUT. The "span"
+	// is the difference between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a
+	// result of our span. The final value is equal to the y-value of the lower point plus this offset.
+	//
+	q9_22_t span = FSUB( radians, nonUniform_fixed_0dot007error[idx].x0 );
+	q0_31_t offset = FMULG( (int64_t)nonUniform_fixed_0dot007error[idx].slope, (int64_t)span, 31, 22, 31 );
+
+	return FADD( nonUniform_fixed_0dot007error[idx].y0, offset );
+}
+
+q0_31_t sin_LUT_fixedPoint_nonUniform(q9_22_t radians)
+{
 	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
 	// to a valid value instead of throwing an error.
 	//
-	while( radians >= TWO_PI_FXD )
+	return sin_LUT_fixedPoint_nonUniform_reduced( reduceRadians_fixedPoint( radians ) );
+}
+
+// The interleaved LUTs compute exactly the same thing as the "_interpolate" LUTs above, but read y0 and the slope from a single
+// {y0, slope} pair instead of reading two table values and subtracting them.
+//
+static inline double sin_LUT_double_interpolate_interleaved_reduced(double radians)
+{
+	double x = radians * 64;
+	int x0 = (int)( x );
+	pair_double_t pair = sinPairs_double[ x0 ];
+	double span = x - (double)( x0 );
+
+	return pair.y0 + ( pair.slope * span );
+}
+
+double sin_LUT_double_interpolate_interleaved(double radians)
+{
+	return sin_LUT_double_interpolate_interleaved_reduced( reduceRadians_double( radians ) );
+}
+
+static inline float sin_LUT_float_interpolate_interleaved_reduced(float radians)
+{
+	float x = radians * 64;
+	int x0 = (int)( x );
+	pair_float_t pair = sinPairs_float[ x0 ];
+	float span = x - (float)( x0 );
+
+	return pair.y0 + ( pair.slope * span );
+}
+
+float sin_LUT_float_interpolate_interleaved(float radians)
+{
+	return sin_LUT_float_interpolate_interleaved_reduced( reduceRadians_float( radians ) );
+}
+
+static inline q0_31_t sin_LUT_fixedPoint_interpolate_interleaved_reduced(q9_22_t radians)
+{
+	q9_22_t x = FMULI( radians, 64 );
+	int x0 = FCONV( x, 22, 0 );
+	pair_fixed_t pair = sinPairs_fixedPoint[ x0 ];
+	q9_22_t span = FSUBG( x, x0, 22, 0, 22 );
+	q0_31_t offset = FMULG( (int64_t)pair.slope, (int64_t)span, 31, 22, 31 );
+
+	return FADD( pair.y0, offset );
+}
+
+q0_31_t sin_LUT_fixedPoint_interpolate_interleaved(q9_22_t radians)
+{
+	return sin_LUT_fixedPoint_interpolate_interleaved_reduced( reduceRadians_fixedPoint( radians ) );
+}
+
+// "idx" counts steps of the quarter-wave table from 0 radians, over the whole period ([0, 4*SIN_QUARTER_LUT_STEPS]). Its top two
+// bits give the quadrant: in the odd quadrants sin runs backwards through the table (sin(PI/2 + t) = sin(PI/2 - t)) and in the
+// last two it's negated (sin(PI + t) = -sin(t)). "idx" is masked, so 4*SIN_QUARTER_LUT_STEPS (i.e. 2*PI) wraps back to 0.
+//
+typedef struct quarterIndex_t
+{
+	int entry;		// Index into the quarter-wave table
+	int step;		// +1 or -1; the direction "idx + 1" moves through the table
+	int negate;		// Non-zero if the table value has to be negated
+} quarterIndex_t;
+
+static inline quarterIndex_t quarterIndex(unsigned idx)
+{
+	quarterIndex_t ret;
+	unsigned quadrant = ( idx >> SIN_QUARTER_LUT_STEPS_LOG2 ) & 3u;
+	int offset = (int)( idx & ( SIN_QUARTER_LUT_STEPS - 1 ) );
+	int mirror = (int)( quadrant & 1u );
+
+	ret.entry = mirror ? ( SIN_QUARTER_LUT_STEPS - offset ) : offset;
+	ret.step = 1 - ( 2 * mirror );
+	ret.negate = (int)( quadrant & 2u );
+
+	return ret;
+}
+
+static inline double sin_LUT_double_quarter_reduced(double radians)
+{
+	// Same rounding as sin_LUT_double, but in steps of the quarter-wave table
+	//
+	quarterIndex_t q = quarterIndex( (unsigned)( ( radians * SIN_QUARTER_LUT_SCALE ) + 0.5 ) );
+	double ret = sinQuarter_double[ q.entry ];
+
+	return q.negate ? -ret : ret;
+}
+
+double sin_LUT_double_quarter(double radians)
+{
+	return sin_LUT_double_quarter_reduced( reduceRadians_double( radians ) );
+}
+
+static inline float sin_LUT_float_quarter_reduced(float radians)
+{
+	quarterIndex_t q = quarterIndex( (unsigned)( ( radians * (float)SIN_QUARTER_LUT_SCALE ) + 0.5f ) );
+	float ret = sinQuarter_float[ q.entry ];
+
+	return q.negate ? -ret : ret;
+}
+
+float sin_LUT_float_quarter(float radians)
+{
+	return sin_LUT_float_quarter_reduced( reduceRadians_float( radians ) );
+}
+
+// The fixed-point index is computed in 64 bits: 2*PI in steps of the quarter-wave table is 4*SIN_QUARTER_LUT_STEPS, which can be
+// too big for a q9_22_t (and the scale factor isn't an integer, so FMULI won't do).
+//
+static inline int64_t quarterX_fixedPoint(q9_22_t radians)
+{
+	return FMULG( (int64_t)radians, (int64_t)TOFIX( SIN_QUARTER_LUT_SCALE, 22 ), 22, 22, 22 );
+}
+
+static inline q0_31_t sin_LUT_fixedPoint_quarter_reduced(q9_22_t radians)
+{
+	int64_t x = quarterX_fixedPoint( radians );
+	quarterIndex_t q = quarterIndex( (unsigned)FCONV( x + TOFIX( 0.5, 22 ), 22, 0 ) );
+	q0_31_t ret = sinQuarter_fixedPoint[ q.entry ];
+
+	return q.negate ? -ret : ret;
+}
+
+q0_31_t sin_LUT_fixedPoint_quarter(q9_22_t radians)
+{
+	return sin_LUT_fixedPoint_quarter_reduced( reduceRadians_fixedPoint( radians ) );
+}
+
+// Interpolating works the same way as in the full-period LUTs, except that the second point is "step" away from the first
+// instead of always being the next table entry, and the result is negated in the last two quadrants.
+//
+static inline double sin_LUT_double_quarter_interpolate_reduced(double radians)
+{
+	double x = radians * SIN_QUARTER_LUT_SCALE;
+	int x0 = (int)( x );
+	quarterIndex_t q = quarterIndex( (unsigned)x0 );
+
+	double y0 = sinQuarter_double[ q.entry ];
+	double slope = sinQuarter_double[ q.entry + q.step ] - y0;
+	double span = x - (double)( x0 );
+	double ret = y0 + ( slope * span );
+
+	return q.negate ? -ret : ret;
+}
+
+double sin_LUT_double_quarter_interpolate(double radians)
+{
+	return sin_LUT_double_quarter_interpolate_reduced( reduceRadians_double( radians ) );
+}
+
+static inline float sin_LUT_float_quarter_interpolate_reduced(float radians)
+{
+	float x = radians * (float)SIN_QUARTER_LUT_SCALE;
+	int x0 = (int)( x );
+	quarterIndex_t q = quarterIndex( (unsigned)x0 );
+
+	float y0 = sinQuarter_float[ q.entry ];
+	float slope = sinQuarter_float[ q.entry + q.step ] - y0;
+	float span = x - (float)( x0 );
+	float ret = y0 + ( slope * span );
+
+	return q.negate ? -ret : ret;
+}
+
+float sin_LUT_float_quarter_interpolate(float radians)
+{
+	return sin_LUT_float_quarter_interpolate_reduced( reduceRadians_float( radians ) );
+}
+
+static inline q0_31_t sin_LUT_fixedPoint_quarter_interpolate_reduced(q9_22_t radians)
+{
+	int64_t x = quarterX_fixedPoint( radians );
+	int x0 = (int)FCONV( x, 22, 0 );
+	quarterIndex_t q = quarterIndex( (unsigned)x0 );
+
+	q0_31_t y0 = sinQuarter_fixedPoint[ q.entry ];
+	q0_31_t slope = FSUB( sinQuarter_fixedPoint[ q.entry + q.step ], y0 );
+	q9_22_t span = (q9_22_t)FSUBG( x, (int64_t)x0, 22, 0, 22 );
+	q0_31_t offset = FMULG( (int64_t)slope, (int64_t)span, 31, 22, 31 );
+	q0_31_t ret = FADD( y0, offset );
+
+	return q.negate ? -ret : ret;
+}
+
+q0_31_t sin_LUT_fixedPoint_quarter_interpolate(q9_22_t radians)
+{
+	return sin_LUT_fixedPoint_quarter_interpolate_reduced( reduceRadians_fixedPoint( radians ) );
+}
+
+void sin_LUT_double_batch(const double * restrict in, double * restrict out, size_t n)
+{
+	// Inputs beyond the Cody-Waite limit (or NaN/Inf) need the out-of-line Payne-Hanek reduction, which would keep the loop
+	// below from being inlined and vectorized, so those (rare) batches are handled one element at a time instead.
+	//
+	if( !radiansAreModerate_double( in, n ) )
 	{
-		err = SAFE_FSUB( radians, TWO_PI_FXD, &radians );
-		ASSERT( err == 0 );
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double( in[idx] );
+		return;
 	}
-	while( radians < 0 )
+
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_reduced( reduceRadians_double_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_float_batch(const float * restrict in, float * restrict out, size_t n)
+{
+	if( !radiansAreModerate_float( in, n ) )
 	{
-		err = SAFE_FADD( radians, TWO_PI_FXD, &radians );
-		ASSERT( err == 0 );
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float( in[idx] );
+		return;
 	}
 
-	// Perform a binary search to find the LUT elements that will be used to interpolate the final value. Returns the last 
-	// list element if "radians" is greater than the last element.
-	//
-	while( low <= high )
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_reduced( reduceRadians_float_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_fixedPoint_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n)
+{
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_fixedPoint_reduced( reduceRadians_fixedPoint( in[idx] ) );
+}
+
+void sin_LUT_double_interpolate_batch(const double * restrict in, double * restrict out, size_t n)
+{
+	if( !radiansAreModerate_double( in, n ) )
 	{
-		mid = ( low + high ) / 2;
-		if( ( radians > nonUniform_fixed_0dot007error[mid].x ) && ( radians < nonUniform_fixed_0dot007error[mid+1].x ) ) break;
-		if( radians < nonUniform_fixed_0dot007error[mid].x ) high = mid;
-		else low = mid;
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_interpolate( in[idx] );
+		return;
 	}
 
-	// Set "ret" equal to the y value of the last table element if "mid" came out to be the last element. Otherwise, compute
-	// the linear interpolation.
-	//
-	if( mid == LAST_ELEMENT_0DOT007ERROR ) ret = nonUniform_fixed_0dot007error[mid].y;
-	else
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_interpolate_reduced( reduceRadians_double_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_double_interpolate_batch_table(const double * restrict table, const double * restrict in, double * restrict out, size_t n)
+{
+	if( !radiansAreModerate_double( in, n ) )
 	{
-		// Compute the linear interpolation. The slope is the standard "rise" over "run". The "span" is the difference 
-		// between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a result of our 
-		// span. The final value is equal to the y-value of the lower point plus this offset.
-		//
-		x0 = nonUniform_fixed_0dot007error[mid].x;
-		y0 = nonUniform_fixed_0dot007error[mid].y;
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_interpolate_reduced_table( table, reduceRadians_double( in[idx] ) );
+		return;
+	}
 
-		err = SAFE_FSUB( nonUniform_fixed_0dot007error[mid+1].y, y0, &rise );
-		ASSERT( err == 0 );
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_interpolate_reduced_table( table, reduceRadians_double_codyWaite( in[idx] ) );
+}
 
-		err = SAFE_FSUB( nonUniform_fixed_0dot007error[mid+1].x, x0, &run );
-		ASSERT( err == 0 );
+void sin_LUT_float_interpolate_batch(const float * restrict in, float * restrict out, size_t n)
+{
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_interpolate( in[idx] );
+		return;
+	}
 
-		err = SAFE_FDIVG( rise, run, 31, 22, 31, &slope );
-		ASSERT( err == 0 );
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_interpolate_reduced( reduceRadians_float_codyWaite( in[idx] ) );
+}
 
-		err = SAFE_FSUB( radians, x0, &span );
-		ASSERT( err == 0 );
+void sin_LUT_float_interpolate_batch_table(const float * restrict table, const float * restrict in, float * restrict out, size_t n)
+{
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_interpolate_reduced_table( table, reduceRadians_float( in[idx] ) );
+		return;
+	}
 
-		err = SAFE_FMULG( slope, span, 31, 22, 31, &offset );
-		ASSERT( err == 0 );
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_interpolate_reduced_table( table, reduceRadians_float_codyWaite( in[idx] ) );
+}
 
-		err = SAFE_FADD( y0, offset, &ret );
-		ASSERT( err == 0 );
+void sin_LUT_fixedPoint_interpolate_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n)
+{
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_fixedPoint_interpolate_reduced( reduceRadians_fixedPoint( in[idx] ) );
+}
+
+void sin_LUT_double_nonUniform_batch(const double * restrict in, double * restrict out, size_t n)
+{
+	if( !radiansAreModerate_double( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_nonUniform( in[idx] );
+		return;
 	}
 
-	return ret;
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_nonUniform_reduced( reduceRadians_double_codyWaite( in[idx] ) );
 }
 
-q0_31_t sin_LUT_fixedPoint_nonUniform(q9_22_t radians)
+void sin_LUT_float_nonUniform_batch(const float * restrict in, float * restrict out, size_t n)
 {
-	// The input doesn't necessarily need to be in q9_22 format, since the x-values never go over 2*PI. However, I'm using it here
-	// to avoid needing to rewrite the rest of the test code to accept a fourth function signature (the first two fixed-point LUTs
-	// already require an input parameter of at least q9_22).
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_nonUniform( in[idx] );
+		return;
+	}
 
-	q0_31_t ret;
-	q9_22_t TWO_PI_FXD = TOFIX(TWO_PI, 28);
-	int low = 0;
-	int high = LAST_ELEMENT_0DOT007ERROR;
-	int mid = ( low + high ) / 2;
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_nonUniform_reduced( reduceRadians_float_codyWaite( in[idx] ) );
+}
 
-	// Ensure "radians" is within a valid range. Takes advantage of the fact that sin is periodic to merely "wrap" radians 
-	// to a valid value instead of throwing an error.
-	//
-	while( radians >= TWO_PI_FXD ) radians = FSUB( radians, TWO_PI_FXD );
-	while( radians < 0 ) radians = FADD( radians, TWO_PI_FXD );
+void sin_LUT_fixedPoint_nonUniform_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n)
+{
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_fixedPoint_nonUniform_reduced( reduceRadians_fixedPoint( in[idx] ) );
+}
 
-	// Perform a binary search to find the LUT elements that will be used to interpolate the final value. Returns the last 
-	// list element if "radians" is greater than the last element.
-	//
-	while( low <= high )
+void sin_LUT_double_interpolate_interleaved_batch(const double * restrict in, double * restrict out, size_t n)
+{
+	if( !radiansAreModerate_double( in, n ) )
 	{
-		mid = ( low + high ) / 2;
-		if( ( radians > nonUniform_fixed_0dot007error[mid].x ) && ( radians < nonUniform_fixed_0dot007error[mid+1].x ) ) break;
-		if( radians < nonUniform_fixed_0dot007error[mid].x ) high = mid - 1;
-		else low = mid + 1;
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_interpolate_interleaved( in[idx] );
+		return;
 	}
 
-	// Set "ret" equal to the y value of the last table element if "mid" came out to be the last element. Otherwise, compute
-	// the linear interpolation.
-	//
-	if( mid == LAST_ELEMENT_0DOT007ERROR ) ret = nonUniform_fixed_0dot007error[mid].y;
-	else
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_interpolate_interleaved_reduced( reduceRadians_double_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_float_interpolate_interleaved_batch(const float * restrict in, float * restrict out, size_t n)
+{
+	if( !radiansAreModerate_float( in, n ) )
 	{
-		// Compute the linear interpolation. The slope is the standard "rise" over "run". The "span" is the difference 
-		// between our input and the lower table point, x0. The "offset" is the amount our y-value changes as a result of our 
-		// span. The final value is equal to the y-value of the lower point plus this offset.
-		//
-		q9_22_t x0 = nonUniform_fixed_0dot007error[mid].x;
-		q0_31_t y0 = nonUniform_fixed_0dot007error[mid].y;
-
-		q0_31_t rise = FSUB( nonUniform_fixed_0dot007error[mid+1].y, y0 );
-		q9_22_t run = FSUB( nonUniform_fixed_0dot007error[mid+1].x, x0 );
-		q0_31_t slope = FDIVG( (int64_t)rise, (int64_t)run, 31, 22, 31 );
-		q9_22_t span = FSUB( radians, x0 );
-		q0_31_t offset = FMULG( (int64_t)slope, (int64_t)span, 31, 22, 31 );
-		ret = FADD( y0, offset );
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_interpolate_interleaved( in[idx] );
+		return;
 	}
 
-	return ret;
-}
\ No newline at end of file
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_interpolate_interleaved_reduced( reduceRadians_float_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_fixedPoint_interpolate_interleaved_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n)
+{
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_fixedPoint_interpolate_interleaved_reduced( reduceRadians_fixedPoint( in[idx] ) );
+}
+
+void sin_LUT_float_nonUniform_scan_batch(const float * restrict in, float * restrict out, size_t n)
+{
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_nonUniform_scan( in[idx] );
+		return;
+	}
+
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_nonUniform_scan_reduced( reduceRadians_float_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_double_quarter_interpolate_batch(const double * restrict in, double * restrict out, size_t n)
+{
+	if( !radiansAreModerate_double( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_quarter_interpolate( in[idx] );
+		return;
+	}
+
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_double_quarter_interpolate_reduced( reduceRadians_double_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_float_quarter_interpolate_batch(const float * restrict in, float * restrict out, size_t n)
+{
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_quarter_interpolate( in[idx] );
+		return;
+	}
+
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_float_quarter_interpolate_reduced( reduceRadians_float_codyWaite( in[idx] ) );
+}
+
+void sin_LUT_fixedPoint_quarter_interpolate_batch(const q9_22_t * restrict in, q0_31_t * restrict out, size_t n)
+{
+	for( size_t idx = 0; idx < n; idx++ ) out[idx] = sin_LUT_fixedPoint_quarter_interpolate_reduced( reduceRadians_fixedPoint( in[idx] ) );
+}
+
+// The quarter-wave LUTs' step, for their error bounds (see sin_lut_tables.h)
+//
+#define QUARTER_LUT_STEP ( 1.0 / SIN_QUARTER_LUT_SCALE )
+
+static const sinLUT_registration_t sinLUT_registrations[] =
+{
+	{ .name = "LUT Double", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_LUT_double,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_double ) } },
+	{ .name = "LUT Float", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_float ) } },
+	{ .name = "LUT Fxd Pt", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_fixedPoint ) } },
+	{ .name = "LUT Fxd Safe", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_safe,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_fixedPoint ) } },
+	{ .name = "Dbl Interp", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_LUT_double_interpolate,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_double ) } },
+	{ .name = "Flt Interp", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_interpolate,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_float ) } },
+	{ .name = "Fxd Interp", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_interpolate,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_fixedPoint ) } },
+	{ .name = "Fxd Intp Sf", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_interpolate_safe,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_fixedPoint ) } },
+	{ .name = "Dbl Intp Pair", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_LUT_double_interpolate_interleaved,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_double ) } },
+	{ .name = "Flt Intp Pair", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_interpolate_interleaved,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_float ) } },
+	{ .name = "Fxd Intp Pair", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_interpolate_interleaved,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_fixedPoint ) } },
+	{ .name = "Dbl Quarter", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_LUT_double_quarter,
+		.errorBound = ROUNDED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_double ) } },
+	{ .name = "Flt Quarter", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_quarter,
+		.errorBound = ROUNDED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_float ) } },
+	{ .name = "Fxd Quarter", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_quarter,
+		.errorBound = ROUNDED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_fixedPoint ) } },
+	{ .name = "Dbl Qtr Intp", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_LUT_double_quarter_interpolate,
+		.errorBound = INTERPOLATED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_double ) } },
+	{ .name = "Flt Qtr Intp", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_quarter_interpolate,
+		.errorBound = INTERPOLATED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_float ) } },
+	{ .name = "Fxd Qtr Intp", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_quarter_interpolate,
+		.errorBound = INTERPOLATED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_fixedPoint ) } },
+	{ .name = "Dbl X/Y list", .signature = fcn_dbl_in_dbl_out, .fcn_double = sin_LUT_double_nonUniform,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_double_0dot007error ), SIN_LUT_TABLE( bucket_double_0dot007error ) } },
+	{ .name = "Flt X/Y list", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_nonUniform,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_float_0dot007error ), SIN_LUT_TABLE( bucket_float_0dot007error ) } },
+	{ .name = "Flt X/Y Scan", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_nonUniform_scan,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND, .tables = { SIN_LUT_TABLE( nonUniformScan_float_0dot007error ) } },
+	{ .name = "Fxd X/Y list", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_nonUniform,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_fixed_0dot007error ), SIN_LUT_TABLE( bucket_fixed_0dot007error ) } },
+	{ .name = "Fxd X/Y Safe", .signature = fcn_fxd_in_fxd_out, .fcn_fixedPoint = sin_LUT_fixedPoint_nonUniform_safe,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_fixed_0dot007error ), SIN_LUT_TABLE( bucket_fixed_0dot007error ) } },
+	{ .name = "Dbl LUT Arr", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_batch,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_double ) } },
+	{ .name = "Flt LUT Arr", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_batch,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_float ) } },
+	{ .name = "Fxd LUT Arr", .signature = fcn_fxd_arr_fxd_arr, .fcn_fixedPoint_batch = sin_LUT_fixedPoint_batch,
+		.errorBound = ROUNDED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinCells_fixedPoint ) } },
+	{ .name = "Dbl Intp Arr", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_interpolate_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_double ) } },
+	{ .name = "Flt Intp Arr", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_interpolate_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_float ) } },
+	{ .name = "Fxd Intp Arr", .signature = fcn_fxd_arr_fxd_arr, .fcn_fixedPoint_batch = sin_LUT_fixedPoint_interpolate_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinTable_fixedPoint ) } },
+	{ .name = "Dbl Pair Arr", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_interpolate_interleaved_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_double ) } },
+	{ .name = "Flt Pair Arr", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_interpolate_interleaved_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_float ) } },
+	{ .name = "Fxd Pair Arr", .signature = fcn_fxd_arr_fxd_arr, .fcn_fixedPoint_batch = sin_LUT_fixedPoint_interpolate_interleaved_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_fixedPoint ) } },
+	{ .name = "Dbl Qtr Arr", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_quarter_interpolate_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_double ) } },
+	{ .name = "Flt Qtr Arr", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_quarter_interpolate_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_float ) } },
+	{ .name = "Fxd Qtr Arr", .signature = fcn_fxd_arr_fxd_arr, .fcn_fixedPoint_batch = sin_LUT_fixedPoint_quarter_interpolate_batch,
+		.errorBound = INTERPOLATED_ERROR_BOUND( QUARTER_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinQuarter_fixedPoint ) } },
+	{ .name = "Dbl X/Y Arr", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_nonUniform_batch,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_double_0dot007error ), SIN_LUT_TABLE( bucket_double_0dot007error ) } },
+	{ .name = "Flt X/Y Arr", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_nonUniform_batch,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_float_0dot007error ), SIN_LUT_TABLE( bucket_float_0dot007error ) } },
+	{ .name = "Flt Scan Arr", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_nonUniform_scan_batch,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND, .tables = { SIN_LUT_TABLE( nonUniformScan_float_0dot007error ) } },
+	{ .name = "Fxd X/Y Arr", .signature = fcn_fxd_arr_fxd_arr, .fcn_fixedPoint_batch = sin_LUT_fixedPoint_nonUniform_batch,
+		.errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniform_fixed_0dot007error ), SIN_LUT_TABLE( bucket_fixed_0dot007error ) } },
+
+	// The dispatched kernels read the {y0, slope} tables (the portable fallback reads the smaller plain ones)
+	//
+	{ .name = "Dbl Intp Best", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_interpolate_batch_best,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_double ) } },
+	{ .name = "Flt Intp Best", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_interpolate_batch_best,
+		.errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ), .tables = { SIN_LUT_TABLE( sinPairs_float ) } },
+};
+
+SIN_LUT_REGISTER( sinLUT_registrations )
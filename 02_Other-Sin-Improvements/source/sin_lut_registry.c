@@ -0,0 +1,45 @@
+#include "sin_lut_registry.h"
+#include "assert.h"
+
+// This runs from constructors, before main() and before anything has been allocated, so the registry is a fixed-size array of
+// pointers into each file's own list.
+//
+static const sinLUT_registration_t * registry[SIN_LUT_MAX_REGISTRATIONS];
+static size_t registeredCount = 0;
+
+void sinLUT_register(const sinLUT_registration_t * p_registrations, size_t count)
+{
+	ASSERT( p_registrations != NULL );
+	ASSERT( count <= ( SIN_LUT_MAX_REGISTRATIONS - registeredCount ) );
+
+	for( size_t idx = 0; idx < count; idx++ )
+	{
+		ASSERT( p_registrations[idx].name != NULL );
+		ASSERT( ( p_registrations[idx].signature != NOT_ASSIGNED ) && ( p_registrations[idx].signature != fcn_unsupported ) );
+
+		registry[registeredCount++] = &p_registrations[idx];
+	}
+}
+
+size_t sinLUT_registeredCount(void)
+{
+	return registeredCount;
+}
+
+const sinLUT_registration_t * sinLUT_registered(size_t idx)
+{
+	ASSERT( idx < registeredCount );
+
+	return registry[idx];
+}
+
+size_t sinLUT_memoryBytes(const sinLUT_registration_t * p_registration)
+{
+	size_t ret = 0;
+
+	ASSERT( p_registration != NULL );
+
+	for( int idx = 0; idx < SIN_LUT_MAX_TABLES; idx++ ) ret += p_registration->tables[idx].bytes;
+
+	return ret;
+}
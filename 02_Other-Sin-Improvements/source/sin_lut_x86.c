@@ -0,0 +1,387 @@
+// Hand-vectorized versions of the interpolated sin LUTs for x86. Each function is compiled for its own instruction set with a
+// "target" attribute, so this file doesn't need any special compiler flags; it's only the CPU running the code that needs to
+// support AVX-512, AVX2/FMA or SSE4.1. The scalar versions in sin_lut.c remain the reference implementation.
+//
+// All of them read the interleaved {y0, slope} tables, so the wide gathers fetch a whole pair at once.
+//
+#include <immintrin.h>
+#include "sin_lut.h"
+#include "sin_lut_tables.h"
+#include "sin_lut_registry.h"
+#include "range_reduction.h"
+
+// Every kernel below processes one full vector of inputs per iteration and hands whatever is left over (fewer than 16
+// elements) to the portable batch function. The same goes for batches containing inputs too large (or non-finite) for the
+// Cody-Waite reduction, since the Payne-Hanek reduction has no vector version.
+//
+
+// AVX-512 compares produce a mask register instead of a vector, so the wrap's corrections become masked adds/subtracts.
+//
+__attribute__((target("avx512f")))
+void sin_LUT_float_interpolate_batch_avx512(const float * restrict in, float * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		sin_LUT_float_interpolate_interleaved_batch( in, out, n );
+		return;
+	}
+
+	const __m512 inv_two_pi = _mm512_set1_ps( INV_TWO_PI_FLOAT );
+	const __m512 two_pi = _mm512_set1_ps( TWO_PI_FLOAT );
+	const __m512 c1 = _mm512_set1_ps( CODY_WAITE_C1_FLOAT );
+	const __m512 c2 = _mm512_set1_ps( CODY_WAITE_C2_FLOAT );
+	const __m512 c3 = _mm512_set1_ps( CODY_WAITE_C3_FLOAT );
+	const __m512 zero = _mm512_setzero_ps();
+	const __m512 sixty_four = _mm512_set1_ps( 64.0f );
+	const __m512i even = _mm512_setr_epi32( 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30 );
+	const __m512i odd = _mm512_setr_epi32( 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31 );
+
+	for( ; ( idx + 16 ) <= n; idx += 16 )
+	{
+		__m512 radians = _mm512_loadu_ps( &in[idx] );
+		__m512 k = _mm512_cvtepi32_ps( _mm512_cvttps_epi32( _mm512_mul_ps( radians, inv_two_pi ) ) );
+		radians = _mm512_sub_ps( radians, _mm512_mul_ps( k, c1 ) );
+		radians = _mm512_sub_ps( radians, _mm512_mul_ps( k, c2 ) );
+		radians = _mm512_sub_ps( radians, _mm512_mul_ps( k, c3 ) );
+		radians = _mm512_mask_add_ps( radians, _mm512_cmp_ps_mask( radians, zero, _CMP_LT_OQ ), radians, two_pi );
+		radians = _mm512_mask_sub_ps( radians, _mm512_cmp_ps_mask( radians, two_pi, _CMP_GE_OQ ), radians, two_pi );
+
+		// Each {y0, slope} pair is 64 bits, so two 8-lane gathers fetch all 16 pairs; the even floats are then the y0 values and
+		// the odd floats are the slopes.
+		//
+		__m512 x = _mm512_mul_ps( radians, sixty_four );
+		__m512i x0 = _mm512_cvttps_epi32( x );
+		__m512 pairs_lo = _mm512_castpd_ps( _mm512_i32gather_pd( _mm512_castsi512_si256( x0 ), sinPairs_float, sizeof( pair_float_t ) ) );
+		__m512 pairs_hi = _mm512_castpd_ps( _mm512_i32gather_pd( _mm512_extracti64x4_epi64( x0, 1 ), sinPairs_float, sizeof( pair_float_t ) ) );
+		__m512 y0 = _mm512_permutex2var_ps( pairs_lo, even, pairs_hi );
+		__m512 slope = _mm512_permutex2var_ps( pairs_lo, odd, pairs_hi );
+		__m512 span = _mm512_sub_ps( x, _mm512_cvtepi32_ps( x0 ) );
+		_mm512_storeu_ps( &out[idx], _mm512_fmadd_ps( slope, span, y0 ) );
+	}
+
+	sin_LUT_float_interpolate_interleaved_batch( &in[idx], &out[idx], n - idx );
+}
+
+__attribute__((target("avx512f")))
+void sin_LUT_double_interpolate_batch_avx512(const double * restrict in, double * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_double( in, n ) )
+	{
+		sin_LUT_double_interpolate_interleaved_batch( in, out, n );
+		return;
+	}
+
+	const __m512d inv_two_pi = _mm512_set1_pd( INV_TWO_PI_DOUBLE );
+	const __m512d two_pi = _mm512_set1_pd( TWO_PI_DOUBLE );
+	const __m512d c1 = _mm512_set1_pd( CODY_WAITE_C1_DOUBLE );
+	const __m512d c2 = _mm512_set1_pd( CODY_WAITE_C2_DOUBLE );
+	const __m512d c3 = _mm512_set1_pd( CODY_WAITE_C3_DOUBLE );
+	const __m512d zero = _mm512_setzero_pd();
+	const __m512d sixty_four = _mm512_set1_pd( 64.0 );
+	const double * pairs = (const double *)sinPairs_double;
+
+	for( ; ( idx + 8 ) <= n; idx += 8 )
+	{
+		__m512d radians = _mm512_loadu_pd( &in[idx] );
+		__m512d k = _mm512_cvtepi32_pd( _mm512_cvttpd_epi32( _mm512_mul_pd( radians, inv_two_pi ) ) );
+		radians = _mm512_sub_pd( radians, _mm512_mul_pd( k, c1 ) );
+		radians = _mm512_sub_pd( radians, _mm512_mul_pd( k, c2 ) );
+		radians = _mm512_sub_pd( radians, _mm512_mul_pd( k, c3 ) );
+		radians = _mm512_mask_add_pd( radians, _mm512_cmp_pd_mask( radians, zero, _CMP_LT_OQ ), radians, two_pi );
+		radians = _mm512_mask_sub_pd( radians, _mm512_cmp_pd_mask( radians, two_pi, _CMP_GE_OQ ), radians, two_pi );
+
+		// A {y0, slope} pair of doubles is wider than any gather element, so y0 and the slope are still gathered separately, but
+		// from the same cache line.
+		//
+		__m512d x = _mm512_mul_pd( radians, sixty_four );
+		__m256i x0 = _mm512_cvttpd_epi32( x );
+		__m256i x0_doubled = _mm256_add_epi32( x0, x0 );
+		__m512d y0 = _mm512_i32gather_pd( x0_doubled, pairs, sizeof( double ) );
+		__m512d slope = _mm512_i32gather_pd( x0_doubled, pairs + 1, sizeof( double ) );
+		__m512d span = _mm512_sub_pd( x, _mm512_cvtepi32_pd( x0 ) );
+		_mm512_storeu_pd( &out[idx], _mm512_fmadd_pd( slope, span, y0 ) );
+	}
+
+	sin_LUT_double_interpolate_interleaved_batch( &in[idx], &out[idx], n - idx );
+}
+
+// Wrap 8 inputs at once, exactly as reduceRadians_float_codyWaite does.
+//
+static inline __attribute__((target("avx2"))) __m256 reduce8_ps(__m256 radians)
+{
+	const __m256 two_pi = _mm256_set1_ps( TWO_PI_FLOAT );
+	__m256 k = _mm256_cvtepi32_ps( _mm256_cvttps_epi32( _mm256_mul_ps( radians, _mm256_set1_ps( INV_TWO_PI_FLOAT ) ) ) );
+	radians = _mm256_sub_ps( radians, _mm256_mul_ps( k, _mm256_set1_ps( CODY_WAITE_C1_FLOAT ) ) );
+	radians = _mm256_sub_ps( radians, _mm256_mul_ps( k, _mm256_set1_ps( CODY_WAITE_C2_FLOAT ) ) );
+	radians = _mm256_sub_ps( radians, _mm256_mul_ps( k, _mm256_set1_ps( CODY_WAITE_C3_FLOAT ) ) );
+	radians = _mm256_add_ps( radians, _mm256_and_ps( _mm256_cmp_ps( radians, _mm256_setzero_ps(), _CMP_LT_OQ ), two_pi ) );
+	return _mm256_sub_ps( radians, _mm256_and_ps( _mm256_cmp_ps( radians, two_pi, _CMP_GE_OQ ), two_pi ) );
+}
+
+__attribute__((target("avx2,fma")))
+void sin_LUT_float_interpolate_batch_avx2(const float * restrict in, float * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		sin_LUT_float_interpolate_interleaved_batch( in, out, n );
+		return;
+	}
+
+	const __m256 sixty_four = _mm256_set1_ps( 64.0f );
+
+	for( ; ( idx + 8 ) <= n; idx += 8 )
+	{
+		__m256 radians = reduce8_ps( _mm256_loadu_ps( &in[idx] ) );
+
+		// Compute 8 indices and gather the 64-bit {y0, slope} pair for each, 4 at a time, then interpolate with a fused
+		// multiply-add. The indices are gathered in the order 0,1,4,5 / 2,3,6,7 because the shuffle that separates the y0 values
+		// from the slopes works within each 128-bit half; that way the shuffled results come out in order.
+		//
+		__m256 x = _mm256_mul_ps( radians, sixty_four );
+		__m256i x0 = _mm256_cvttps_epi32( x );
+		__m256i x0_swizzled = _mm256_permute4x64_epi64( x0, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+		const double * pairs = (const double *)sinPairs_float;
+		__m256 pairs_lo = _mm256_castpd_ps( _mm256_i32gather_pd( pairs, _mm256_castsi256_si128( x0_swizzled ), sizeof( pair_float_t ) ) );
+		__m256 pairs_hi = _mm256_castpd_ps( _mm256_i32gather_pd( pairs, _mm256_extracti128_si256( x0_swizzled, 1 ), sizeof( pair_float_t ) ) );
+		__m256 y0 = _mm256_shuffle_ps( pairs_lo, pairs_hi, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+		__m256 slope = _mm256_shuffle_ps( pairs_lo, pairs_hi, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+		__m256 span = _mm256_sub_ps( x, _mm256_cvtepi32_ps( x0 ) );
+		_mm256_storeu_ps( &out[idx], _mm256_fmadd_ps( slope, span, y0 ) );
+	}
+
+	sin_LUT_float_interpolate_interleaved_batch( &in[idx], &out[idx], n - idx );
+}
+
+__attribute__((target("avx2,fma")))
+void sin_LUT_double_interpolate_batch_avx2(const double * restrict in, double * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_double( in, n ) )
+	{
+		sin_LUT_double_interpolate_interleaved_batch( in, out, n );
+		return;
+	}
+
+	const __m256d inv_two_pi = _mm256_set1_pd( INV_TWO_PI_DOUBLE );
+	const __m256d two_pi = _mm256_set1_pd( TWO_PI_DOUBLE );
+	const __m256d c1 = _mm256_set1_pd( CODY_WAITE_C1_DOUBLE );
+	const __m256d c2 = _mm256_set1_pd( CODY_WAITE_C2_DOUBLE );
+	const __m256d c3 = _mm256_set1_pd( CODY_WAITE_C3_DOUBLE );
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d sixty_four = _mm256_set1_pd( 64.0 );
+	const double * pairs = (const double *)sinPairs_double;
+
+	for( ; ( idx + 4 ) <= n; idx += 4 )
+	{
+		__m256d radians = _mm256_loadu_pd( &in[idx] );
+		__m256d k = _mm256_cvtepi32_pd( _mm256_cvttpd_epi32( _mm256_mul_pd( radians, inv_two_pi ) ) );
+		radians = _mm256_sub_pd( radians, _mm256_mul_pd( k, c1 ) );
+		radians = _mm256_sub_pd( radians, _mm256_mul_pd( k, c2 ) );
+		radians = _mm256_sub_pd( radians, _mm256_mul_pd( k, c3 ) );
+		radians = _mm256_add_pd( radians, _mm256_and_pd( _mm256_cmp_pd( radians, zero, _CMP_LT_OQ ), two_pi ) );
+		radians = _mm256_sub_pd( radians, _mm256_and_pd( _mm256_cmp_pd( radians, two_pi, _CMP_GE_OQ ), two_pi ) );
+
+		// The four indices only need 32 bits each, so they fit in a 128-bit register.
+		//
+		__m256d x = _mm256_mul_pd( radians, sixty_four );
+		__m128i x0 = _mm256_cvttpd_epi32( x );
+		__m128i x0_doubled = _mm_add_epi32( x0, x0 );
+		__m256d y0 = _mm256_i32gather_pd( pairs, x0_doubled, sizeof( double ) );
+		__m256d slope = _mm256_i32gather_pd( pairs + 1, x0_doubled, sizeof( double ) );
+		__m256d span = _mm256_sub_pd( x, _mm256_cvtepi32_pd( x0 ) );
+		_mm256_storeu_pd( &out[idx], _mm256_fmadd_pd( slope, span, y0 ) );
+	}
+
+	sin_LUT_double_interpolate_interleaved_batch( &in[idx], &out[idx], n - idx );
+}
+
+// SSE4.1 has no gather instruction, so the wrap and the interpolation are vectorized but the {y0, slope} pairs are loaded one
+// at a time. It also has no FMA, so the result is computed with a separate multiply and add, just like the scalar version.
+//
+__attribute__((target("sse4.1")))
+void sin_LUT_float_interpolate_batch_sse41(const float * restrict in, float * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		sin_LUT_float_interpolate_interleaved_batch( in, out, n );
+		return;
+	}
+
+	const __m128 inv_two_pi = _mm_set1_ps( INV_TWO_PI_FLOAT );
+	const __m128 two_pi = _mm_set1_ps( TWO_PI_FLOAT );
+	const __m128 c1 = _mm_set1_ps( CODY_WAITE_C1_FLOAT );
+	const __m128 c2 = _mm_set1_ps( CODY_WAITE_C2_FLOAT );
+	const __m128 c3 = _mm_set1_ps( CODY_WAITE_C3_FLOAT );
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 sixty_four = _mm_set1_ps( 64.0f );
+
+	for( ; ( idx + 4 ) <= n; idx += 4 )
+	{
+		__m128 radians = _mm_loadu_ps( &in[idx] );
+		__m128 k = _mm_cvtepi32_ps( _mm_cvttps_epi32( _mm_mul_ps( radians, inv_two_pi ) ) );
+		radians = _mm_sub_ps( radians, _mm_mul_ps( k, c1 ) );
+		radians = _mm_sub_ps( radians, _mm_mul_ps( k, c2 ) );
+		radians = _mm_sub_ps( radians, _mm_mul_ps( k, c3 ) );
+		radians = _mm_add_ps( radians, _mm_and_ps( _mm_cmplt_ps( radians, zero ), two_pi ) );
+		radians = _mm_sub_ps( radians, _mm_and_ps( _mm_cmpge_ps( radians, two_pi ), two_pi ) );
+
+		__m128 x = _mm_mul_ps( radians, sixty_four );
+		__m128i x0 = _mm_cvttps_epi32( x );
+		int i0 = _mm_extract_epi32( x0, 0 );
+		int i1 = _mm_extract_epi32( x0, 1 );
+		int i2 = _mm_extract_epi32( x0, 2 );
+		int i3 = _mm_extract_epi32( x0, 3 );
+		__m128 pairs_lo = _mm_loadh_pi( _mm_loadl_pi( zero, (const __m64 *)&sinPairs_float[i0] ), (const __m64 *)&sinPairs_float[i1] );
+		__m128 pairs_hi = _mm_loadh_pi( _mm_loadl_pi( zero, (const __m64 *)&sinPairs_float[i2] ), (const __m64 *)&sinPairs_float[i3] );
+		__m128 y0 = _mm_shuffle_ps( pairs_lo, pairs_hi, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+		__m128 slope = _mm_shuffle_ps( pairs_lo, pairs_hi, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+		__m128 span = _mm_sub_ps( x, _mm_cvtepi32_ps( x0 ) );
+		_mm_storeu_ps( &out[idx], _mm_add_ps( _mm_mul_ps( slope, span ), y0 ) );
+	}
+
+	sin_LUT_float_interpolate_interleaved_batch( &in[idx], &out[idx], n - idx );
+}
+
+__attribute__((target("sse4.1")))
+void sin_LUT_double_interpolate_batch_sse41(const double * restrict in, double * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_double( in, n ) )
+	{
+		sin_LUT_double_interpolate_interleaved_batch( in, out, n );
+		return;
+	}
+
+	const __m128d inv_two_pi = _mm_set1_pd( INV_TWO_PI_DOUBLE );
+	const __m128d two_pi = _mm_set1_pd( TWO_PI_DOUBLE );
+	const __m128d c1 = _mm_set1_pd( CODY_WAITE_C1_DOUBLE );
+	const __m128d c2 = _mm_set1_pd( CODY_WAITE_C2_DOUBLE );
+	const __m128d c3 = _mm_set1_pd( CODY_WAITE_C3_DOUBLE );
+	const __m128d zero = _mm_setzero_pd();
+	const __m128d sixty_four = _mm_set1_pd( 64.0 );
+
+	for( ; ( idx + 2 ) <= n; idx += 2 )
+	{
+		__m128d radians = _mm_loadu_pd( &in[idx] );
+		__m128d k = _mm_cvtepi32_pd( _mm_cvttpd_epi32( _mm_mul_pd( radians, inv_two_pi ) ) );
+		radians = _mm_sub_pd( radians, _mm_mul_pd( k, c1 ) );
+		radians = _mm_sub_pd( radians, _mm_mul_pd( k, c2 ) );
+		radians = _mm_sub_pd( radians, _mm_mul_pd( k, c3 ) );
+		radians = _mm_add_pd( radians, _mm_and_pd( _mm_cmplt_pd( radians, zero ), two_pi ) );
+		radians = _mm_sub_pd( radians, _mm_and_pd( _mm_cmpge_pd( radians, two_pi ), two_pi ) );
+
+		__m128d x = _mm_mul_pd( radians, sixty_four );
+		__m128i x0 = _mm_cvttpd_epi32( x );
+		int i0 = _mm_extract_epi32( x0, 0 );
+		int i1 = _mm_extract_epi32( x0, 1 );
+		__m128d pair0 = _mm_load_pd( &sinPairs_double[i0].y0 );
+		__m128d pair1 = _mm_load_pd( &sinPairs_double[i1].y0 );
+		__m128d y0 = _mm_unpacklo_pd( pair0, pair1 );
+		__m128d slope = _mm_unpackhi_pd( pair0, pair1 );
+		__m128d span = _mm_sub_pd( x, _mm_cvtepi32_pd( x0 ) );
+		_mm_storeu_pd( &out[idx], _mm_add_pd( _mm_mul_pd( slope, span ), y0 ) );
+	}
+
+	sin_LUT_double_interpolate_interleaved_batch( &in[idx], &out[idx], n - idx );
+}
+
+// The non-uniform float LUT, finding each segment with a linear scan of the struct-of-arrays knot table instead of a search.
+// With only 25 knots, comparing an input against all of them takes 4 vector compares, and because the knots are sorted the
+// number that are <= the input (minus one) is its segment. Every CPU with AVX2 also has POPCNT.
+//
+__attribute__((target("avx2,popcnt")))
+float sin_LUT_float_nonUniform_scan_avx2(float radians)
+{
+	const float * x0 = nonUniformScan_float_0dot007error.x0;
+
+	radians = reduceRadians_float( radians );
+
+	__m256 key = _mm256_set1_ps( radians );
+	uint32_t mask = (uint32_t)_mm256_movemask_ps( _mm256_cmp_ps( key, _mm256_load_ps( &x0[0] ), _CMP_GE_OQ ) );
+	mask |= (uint32_t)_mm256_movemask_ps( _mm256_cmp_ps( key, _mm256_load_ps( &x0[8] ), _CMP_GE_OQ ) ) << 8;
+	mask |= (uint32_t)_mm256_movemask_ps( _mm256_cmp_ps( key, _mm256_load_ps( &x0[16] ), _CMP_GE_OQ ) ) << 16;
+	mask |= (uint32_t)_mm256_movemask_ps( _mm256_cmp_ps( key, _mm256_load_ps( &x0[24] ), _CMP_GE_OQ ) ) << 24;
+
+	int idx = __builtin_popcount( mask ) - 1;
+
+	return nonUniformScan_float_0dot007error.y0[idx] + ( nonUniformScan_float_0dot007error.slope[idx] * ( radians - x0[idx] ) );
+}
+
+// The array version turns the scan around: 8 inputs are compared against one knot at a time, and each lane counts how many knots
+// it has passed (a true compare is all ones, i.e. -1, so subtracting it adds one). Then y0, slope and x0 are gathered by segment.
+//
+__attribute__((target("avx2,fma")))
+void sin_LUT_float_nonUniform_scan_batch_avx2(const float * restrict in, float * restrict out, size_t n)
+{
+	size_t idx = 0;
+
+	if( !radiansAreModerate_float( in, n ) )
+	{
+		sin_LUT_float_nonUniform_scan_batch( in, out, n );
+		return;
+	}
+
+	const float * x0 = nonUniformScan_float_0dot007error.x0;
+
+	for( ; ( idx + 8 ) <= n; idx += 8 )
+	{
+		__m256 radians = reduce8_ps( _mm256_loadu_ps( &in[idx] ) );
+
+		// The first knot is 0, which every wrapped input is >=, so start the count at 0 instead of -1 and skip that compare.
+		// The padding past the last knot is +Inf, so there's no need to compare against it either.
+		//
+		__m256i segment = _mm256_setzero_si256();
+		for( int knot = 1; knot < NONUNIFORM_0DOT007ERROR_SIZE; knot++ )
+		{
+			__m256 passed = _mm256_cmp_ps( radians, _mm256_set1_ps( x0[knot] ), _CMP_GE_OQ );
+			segment = _mm256_sub_epi32( segment, _mm256_castps_si256( passed ) );
+		}
+
+		__m256 y0 = _mm256_i32gather_ps( nonUniformScan_float_0dot007error.y0, segment, sizeof( float ) );
+		__m256 slope = _mm256_i32gather_ps( nonUniformScan_float_0dot007error.slope, segment, sizeof( float ) );
+		__m256 span = _mm256_sub_ps( radians, _mm256_i32gather_ps( x0, segment, sizeof( float ) ) );
+		_mm256_storeu_ps( &out[idx], _mm256_fmadd_ps( slope, span, y0 ) );
+	}
+
+	sin_LUT_float_nonUniform_scan_batch( &in[idx], &out[idx], n - idx );
+}
+
+static const sinLUT_registration_t sinLUT_x86_registrations[] =
+{
+	{ .name = "Flt Scan AVX2", .signature = fcn_flt_in_flt_out, .fcn_float = sin_LUT_float_nonUniform_scan_avx2,
+		.kernel = SIN_LUT_KERNEL_AVX2, .errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniformScan_float_0dot007error ) } },
+	{ .name = "Flt ScnArr AVX2", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_nonUniform_scan_batch_avx2,
+		.kernel = SIN_LUT_KERNEL_AVX2, .errorBound = NONUNIFORM_0DOT007ERROR_BOUND,
+		.tables = { SIN_LUT_TABLE( nonUniformScan_float_0dot007error ) } },
+	{ .name = "Dbl Intp SSE", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_interpolate_batch_sse41,
+		.kernel = SIN_LUT_KERNEL_SSE41, .errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ),
+		.tables = { SIN_LUT_TABLE( sinPairs_double ) } },
+	{ .name = "Flt Intp SSE", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_interpolate_batch_sse41,
+		.kernel = SIN_LUT_KERNEL_SSE41, .errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ),
+		.tables = { SIN_LUT_TABLE( sinPairs_float ) } },
+	{ .name = "Dbl Intp AVX2", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_interpolate_batch_avx2,
+		.kernel = SIN_LUT_KERNEL_AVX2, .errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ),
+		.tables = { SIN_LUT_TABLE( sinPairs_double ) } },
+	{ .name = "Flt Intp AVX2", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_interpolate_batch_avx2,
+		.kernel = SIN_LUT_KERNEL_AVX2, .errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ),
+		.tables = { SIN_LUT_TABLE( sinPairs_float ) } },
+	{ .name = "Dbl Intp 512", .signature = fcn_dbl_arr_dbl_arr, .fcn_double_batch = sin_LUT_double_interpolate_batch_avx512,
+		.kernel = SIN_LUT_KERNEL_AVX512, .errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ),
+		.tables = { SIN_LUT_TABLE( sinPairs_double ) } },
+	{ .name = "Flt Intp 512", .signature = fcn_flt_arr_flt_arr, .fcn_float_batch = sin_LUT_float_interpolate_batch_avx512,
+		.kernel = SIN_LUT_KERNEL_AVX512, .errorBound = INTERPOLATED_ERROR_BOUND( UNIFORM_LUT_STEP ),
+		.tables = { SIN_LUT_TABLE( sinPairs_float ) } },
+};
+
+SIN_LUT_REGISTER( sinLUT_x86_registrations )
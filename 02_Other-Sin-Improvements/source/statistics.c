@@ -0,0 +1,63 @@
+#include <math.h>
+#include <stdlib.h>
+#include "statistics.h"
+#include "assert.h"
+
+static int compareSamples(const void * p_a, const void * p_b)
+{
+	uint32_t a = *(const uint32_t *)p_a;
+	uint32_t b = *(const uint32_t *)p_b;
+
+	return ( a > b ) - ( a < b );
+}
+
+// Nearest-rank percentile of a sorted array: the smallest sample that at least "fraction" of the samples are <=
+//
+static double percentile(const uint32_t * sorted, uint32_t n, double fraction)
+{
+	uint32_t rank = (uint32_t)ceil( fraction * (double)n );
+	if( rank < 1 ) rank = 1;
+
+	return (double)sorted[ rank - 1 ];
+}
+
+void timingStats_compute(uint32_t * samples, uint32_t n, double trimFraction, timingStats_t * stats)
+{
+	ASSERT( samples != NULL );
+	ASSERT( stats != NULL );
+	ASSERT( n > 0 );
+	ASSERT( ( trimFraction >= 0.0 ) && ( trimFraction < 1.0 ) );
+
+	qsort( samples, n, sizeof( uint32_t ), compareSamples );
+
+	stats->samples = n;
+	stats->min = (double)samples[0];
+	stats->median = percentile( samples, n, 0.5 );
+	stats->p90 = percentile( samples, n, 0.9 );
+	stats->p99 = percentile( samples, n, 0.99 );
+	stats->p999 = percentile( samples, n, 0.999 );
+	stats->max = (double)samples[ n - 1 ];
+
+	uint32_t kept = n - (uint32_t)( trimFraction * (double)n );
+	if( kept < 1 ) kept = 1;
+	stats->samples_trimmed = kept;
+
+	// Two passes (mean, then the squared differences from it) instead of a running sum of squares, which loses precision when
+	// the spread is small compared to the mean
+	//
+	double sum = 0.0;
+	for( uint32_t idx = 0; idx < kept; idx++ ) sum += (double)samples[idx];
+	stats->mean = sum / (double)kept;
+
+	double sumOfSquares = 0.0;
+	for( uint32_t idx = 0; idx < kept; idx++ )
+	{
+		double difference = (double)samples[idx] - stats->mean;
+		sumOfSquares += difference * difference;
+	}
+	stats->stddev = ( kept > 1 ) ? sqrt( sumOfSquares / (double)( kept - 1 ) ) : 0.0;
+
+	// Normal approximation (z = 1.96), which is close enough to Student's t for the hundreds of samples the harness takes
+	//
+	stats->ci95 = 1.96 * stats->stddev / sqrt( (double)kept );
+}
@@ -0,0 +1,104 @@
+// Compare the three ways nonUniformLUT_double can find a segment (see include/nonuniform_lut.h) as the number of knots grows
+// from 16 to 64K, to show where each one starts to win. There is no Makefile for this; from this folder, compile using GCC with
+// the command `gcc -I../include -I../libraries/Assert -D__FILENAME__=\"non-uniform-search-benchmark.c\" -O2
+// non-uniform-search-benchmark.c ../source/nonuniform_lut.c -lm` and run the resulting program (called `a.out`).
+//
+// Needed for clock_gettime()
+// Has to be at the begining of the file
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "nonuniform_lut.h"
+#include "../libraries/Assert/assert.h"
+
+#define PI (3.14159265358979000f)
+#define TWO_PI (2.0*PI)
+
+#define MIN_KNOTS 16
+#define MAX_KNOTS 65536
+#define NUM_INPUTS 1000000
+#define NUM_SEARCHES 3
+
+void assert_failed(const char * file, uint32_t line)
+{
+	fprintf(stderr, "ERROR: Assert failed in %s at line %d\n", file, line);
+	exit(-1);
+}
+
+static double now_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ( 1e9 * now.tv_sec ) + now.tv_nsec;
+}
+
+int main(int argc, char * argv[])
+{
+	const char * names[NUM_SEARCHES] = { "Binary", "Branchless", "Eytzinger" };
+	double * x = (double *)malloc( MAX_KNOTS * sizeof( double ) );
+	double * y = (double *)malloc( MAX_KNOTS * sizeof( double ) );
+	double * in = (double *)malloc( NUM_INPUTS * sizeof( double ) );
+	double * out = (double *)malloc( NUM_INPUTS * sizeof( double ) );
+	double * reference = (double *)malloc( NUM_INPUTS * sizeof( double ) );
+	ASSERT( ( x != NULL ) && ( y != NULL ) && ( in != NULL ) && ( out != NULL ) && ( reference != NULL ) );
+
+	// Random inputs, so that the searches can't learn a pattern
+	//
+	srand( 1 );
+	for( int idx = 0; idx < NUM_INPUTS; idx++ ) in[idx] = (double) rand() / (double) RAND_MAX * TWO_PI;
+
+	printf("Knots\t%-12s%-12s%-12s(ns per look-up)\tFastest\n", names[0], names[1], names[2]);
+	printf("--------------------------------------------------------------------------------\n");
+
+	for( int numKnots = MIN_KNOTS; numKnots <= MAX_KNOTS; numKnots *= 2 )
+	{
+		// Space the knots non-uniformly (closer together near 0) so that the table resembles a real non-uniform LUT
+		//
+		for( int idx = 0; idx < numKnots; idx++ )
+		{
+			double fraction = (double) idx / (double)( numKnots - 1 );
+			x[idx] = TWO_PI * fraction * fraction;
+			y[idx] = sin( x[idx] );
+		}
+
+		double time_ns[NUM_SEARCHES];
+		int fastest = 0;
+
+		for( int search = 0; search < NUM_SEARCHES; search++ )
+		{
+			p_nonUniformLUT_double_t lut = nonUniformLUT_double_create( x, y, numKnots, (nonUniformSearch_t) search );
+			ASSERT( lut != NULL );
+
+			// One untimed pass to warm up the caches (and to check that every search finds the same segments), then the best
+			// of several timed passes
+			//
+			nonUniformLUT_double_batch( lut, in, ( search == 0 ) ? reference : out, NUM_INPUTS );
+			if( search != 0 ) for( int idx = 0; idx < NUM_INPUTS; idx++ ) ASSERT( out[idx] == reference[idx] );
+
+			time_ns[search] = INFINITY;
+			for( int rep = 0; rep < 5; rep++ )
+			{
+				double start = now_ns();
+				nonUniformLUT_double_batch( lut, in, out, NUM_INPUTS );
+				double elapsed = ( now_ns() - start ) / NUM_INPUTS;
+				if( elapsed < time_ns[search] ) time_ns[search] = elapsed;
+			}
+
+			if( time_ns[search] < time_ns[fastest] ) fastest = search;
+			nonUniformLUT_double_destroy( lut );
+		}
+
+		printf("%d\t%-12.2f%-12.2f%-12.2f\t\t\t%s\n", numKnots, time_ns[0], time_ns[1], time_ns[2], names[fastest]);
+	}
+
+	free( x );
+	free( y );
+	free( in );
+	free( out );
+	free( reference );
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,1025 @@
+// Build a non-uniform LUT for a function and write it out as a C header and source file, ready to compile: the table of
+// segments ({x0, y0, slope}, with the slopes already worked out) and a function that looks an input up in it. There is no
+// Makefile for this; from this folder, compile using GCC with the command `gcc -I./ -D__FILENAME__=\"table-compiler.c\" -O2
+// table-compiler.c -lm` and run the resulting program (called `a.out`) with "--help" to see its options. For example,
+//
+//     ./a.out --function=sin --domain=0:6.283185307179586 --max-error=0.007 --type=float --name=sin_lut
+//
+// writes sin_lut.h and sin_lut.c.
+//
+// The knots are placed without needing to know anything about the function (e.g. where |f''| peaks, as the README's method
+// does): starting from the bottom of the domain, each segment is made as long as it can be (found by bisection) while the
+// largest error anywhere along it, measured by sampling the function densely, stays within the budget. The error is measured
+// with the knots rounded to the table's data type, and the finished table is then checked with the same arithmetic the
+// generated look-up uses; if rounding pushed it over the budget, the knots are placed again with a slightly tighter one.
+//
+// With "--minimax", the knots' values are also allowed to move off the curve (see placeKnots_minimax), which lets each segment
+// use the whole budget on both sides of the function and so needs roughly 30% fewer knots.
+//
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assert.h"
+#include "error.h"
+
+// The number of points each segment's error is sampled at while placing knots, and at when the finished table is checked
+// (which is done once, so it can afford to look more closely), and the number of bisection steps used to find each knot
+//
+#define SEGMENT_SAMPLES 256
+#define VERIFY_SAMPLES 4096
+#define BISECTION_STEPS 60
+
+// The number of bisection steps used to shrink the budget once the fewest knots it needs are known (see placeKnots_minimax)
+//
+#define EQUALIZING_STEPS 24
+
+// How many times to tighten the budget and try again if rounding pushed the finished table over it
+//
+#define MAX_ATTEMPTS 20
+
+static double sigmoid(double x)
+{
+	return 1.0 / ( 1.0 + exp( -x ) );
+}
+
+typedef struct function_t
+{
+	const char * name;
+	double (*p_f)(double);
+} function_t;
+
+static const function_t functions[] =
+{
+	{ "sin", sin },
+	{ "cos", cos },
+	{ "tan", tan },
+	{ "atan", atan },
+	{ "exp", exp },
+	{ "log", log },
+	{ "sqrt", sqrt },
+	{ "sigmoid", sigmoid },
+};
+
+#define NUM_FUNCTIONS ( sizeof( functions ) / sizeof( functions[0] ) )
+
+typedef enum valueType_t
+{
+	TYPE_DOUBLE,
+	TYPE_FLOAT,
+	TYPE_FIXED
+} valueType_t;
+
+// A fixed-point format, qI.F: a signed 32-bit integer with I integer bits and F fractional bits (I + F <= 31)
+//
+typedef struct qFormat_t
+{
+	int integerBits;
+	int fractionBits;
+} qFormat_t;
+
+typedef struct compilerOptions_t
+{
+	const function_t * p_function;	// NULL if the function comes from a sample file
+	const char * sampleFile;
+	double domain_min;
+	double domain_max;
+	double maxError;
+	valueType_t type;
+	qFormat_t xFormat;				// Only used with TYPE_FIXED
+	qFormat_t yFormat;
+	const char * name;
+	int minimax;					// Move the knots off the curve to need fewer of them (see placeKnots_minimax)
+} compilerOptions_t;
+
+// A function given as samples: sorted, strictly increasing x-values, linearly interpolated between
+//
+typedef struct samples_t
+{
+	double * x;
+	double * y;
+	size_t size;
+} samples_t;
+
+typedef struct knot_t
+{
+	double x;
+	double y;
+} knot_t;
+
+typedef struct table_t
+{
+	knot_t * knots;
+	size_t size;
+	size_t capacity;
+	int slopeFractionBits;			// Only used with TYPE_FIXED
+} table_t;
+
+static compilerOptions_t options;
+static samples_t samples;
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// The function being tabulated
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static size_t samples_segment(double x)
+{
+	size_t low = 0, size = samples.size - 1;
+
+	while( size > 1 )
+	{
+		size_t half = size / 2;
+		low = ( samples.x[low + half] <= x ) ? ( low + half ) : low;
+		size -= half;
+	}
+
+	return low;
+}
+
+static double f(double x)
+{
+	if( options.p_function != NULL ) return options.p_function->p_f( x );
+
+	size_t idx = samples_segment( x );
+
+	return samples.y[idx] + ( ( samples.y[idx+1] - samples.y[idx] ) * ( x - samples.x[idx] ) / ( samples.x[idx+1] - samples.x[idx] ) );
+}
+
+// Read "x y" pairs, one per line, from a text file (lines starting with '#' are ignored). Returns 0 if there were at least two,
+// in strictly increasing order of x.
+//
+static errno_t readSamples(const char * p_file)
+{
+	char line[256];
+	size_t capacity = 0;
+	FILE * p_stream = fopen( p_file, "r" );
+
+	if( p_stream == NULL ) return -1;
+
+	while( fgets( line, sizeof( line ), p_stream ) != NULL )
+	{
+		double x, y;
+
+		if( ( line[0] == '#' ) || ( sscanf( line, "%lf %lf", &x, &y ) != 2 ) ) continue;
+
+		if( samples.size == capacity )
+		{
+			capacity = ( capacity == 0 ) ? 256 : ( capacity * 2 );
+			samples.x = (double *)realloc( samples.x, capacity * sizeof( double ) );
+			samples.y = (double *)realloc( samples.y, capacity * sizeof( double ) );
+			ASSERT( ( samples.x != NULL ) && ( samples.y != NULL ) );
+		}
+
+		if( ( samples.size > 0 ) && ( x <= samples.x[samples.size - 1] ) )
+		{
+			fclose( p_stream );
+			return -1;
+		}
+
+		samples.x[samples.size] = x;
+		samples.y[samples.size] = y;
+		samples.size++;
+	}
+
+	fclose( p_stream );
+
+	return ( samples.size >= 2 ) ? 0 : -1;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// The table's data type
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static double toFixed(double value, int fractionBits)
+{
+	return ldexp( value, fractionBits );
+}
+
+static double fromFixed(double value, int fractionBits)
+{
+	return ldexp( value, -fractionBits );
+}
+
+static int fitsFixed(double value, qFormat_t format)
+{
+	return ( value >= -ldexp( 1.0, format.integerBits ) ) && ( value < ldexp( 1.0, format.integerBits ) );
+}
+
+// A knot's x-value, rounded down to the table's data type (down, so that rounding never makes a segment longer)
+//
+static double roundX(double x)
+{
+	double ret = x;
+
+	if( options.type == TYPE_FLOAT )
+	{
+		float rounded = (float) x;
+		if( (double) rounded > x ) rounded = nextafterf( rounded, -INFINITY );
+		ret = rounded;
+	}
+	else if( options.type == TYPE_FIXED ) ret = fromFixed( floor( toFixed( x, options.xFormat.fractionBits ) ), options.xFormat.fractionBits );
+
+	return ret;
+}
+
+// A y-value or slope, rounded to the nearest value the table's data type can hold (a fixed-point value saturates, so that
+// e.g. sin's peak of 1.0 is stored in a q0.31 as the largest value under it)
+//
+static double roundValue(double value, int fractionBits)
+{
+	double ret = value;
+
+	if( options.type == TYPE_FLOAT ) ret = (float) value;
+	else if( options.type == TYPE_FIXED )
+	{
+		ret = nearbyint( toFixed( value, fractionBits ) );
+		ret = fmin( fmax( ret, -ldexp( 1.0, 31 ) ), ldexp( 1.0, 31 ) - 1.0 );
+		ret = fromFixed( ret, fractionBits );
+	}
+
+	return ret;
+}
+
+static double roundY(double y)
+{
+	return roundValue( y, options.yFormat.fractionBits );
+}
+
+static double roundSlope(const table_t * p_table, double slope)
+{
+	return roundValue( slope, p_table->slopeFractionBits );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Placing the knots
+// ---------------------------------------------------------------------------------------------------------------------------
+
+// The largest error of the segment from knot 0 to knot 1 (whose values have already been rounded), with the slope rounded as
+// the table would store it. For a function given as samples, the segment's error is largest at one of the samples; otherwise
+// the function is sampled evenly along the segment and the largest error found is refined by golden-section search.
+//
+static double segmentError(const table_t * p_table, knot_t knot0, knot_t knot1)
+{
+	double slope = roundSlope( p_table, ( knot1.y - knot0.y ) / ( knot1.x - knot0.x ) );
+	double ret = fabs( f( knot0.x ) - knot0.y );
+
+	if( options.p_function == NULL )
+	{
+		for( size_t idx = samples_segment( knot0.x ); ( idx < samples.size ) && ( samples.x[idx] <= knot1.x ); idx++ )
+		{
+			if( samples.x[idx] < knot0.x ) continue;
+			double error = fabs( samples.y[idx] - ( knot0.y + ( slope * ( samples.x[idx] - knot0.x ) ) ) );
+			if( error > ret ) ret = error;
+		}
+
+		return ret;
+	}
+
+	double step = ( knot1.x - knot0.x ) / SEGMENT_SAMPLES, worst_x = knot0.x;
+
+	for( int idx = 1; idx <= SEGMENT_SAMPLES; idx++ )
+	{
+		double x = ( idx == SEGMENT_SAMPLES ) ? knot1.x : ( knot0.x + ( idx * step ) );
+		double error = fabs( f( x ) - ( knot0.y + ( slope * ( x - knot0.x ) ) ) );
+		if( error > ret )
+		{
+			ret = error;
+			worst_x = x;
+		}
+	}
+
+	double low = fmax( knot0.x, worst_x - step ), high = fmin( knot1.x, worst_x + step );
+	for( int iteration = 0; iteration < 40; iteration++ )
+	{
+		double x_a = high - ( 0.6180339887498949 * ( high - low ) ), x_b = low + ( 0.6180339887498949 * ( high - low ) );
+		double error_a = fabs( f( x_a ) - ( knot0.y + ( slope * ( x_a - knot0.x ) ) ) );
+		double error_b = fabs( f( x_b ) - ( knot0.y + ( slope * ( x_b - knot0.x ) ) ) );
+
+		if( error_a > ret ) ret = error_a;
+		if( error_b > ret ) ret = error_b;
+		if( error_a > error_b ) high = x_b;
+		else low = x_a;
+	}
+
+	return ret;
+}
+
+static knot_t makeKnot(double x)
+{
+	knot_t ret = { roundX( x ), 0.0 };
+
+	ret.y = roundY( f( ret.x ) );
+
+	return ret;
+}
+
+static void addKnot(table_t * p_table, knot_t knot)
+{
+	if( p_table->size == p_table->capacity )
+	{
+		p_table->capacity = ( p_table->capacity == 0 ) ? 64 : ( p_table->capacity * 2 );
+		p_table->knots = (knot_t *)realloc( p_table->knots, p_table->capacity * sizeof( knot_t ) );
+		ASSERT( p_table->knots != NULL );
+	}
+
+	p_table->knots[p_table->size++] = knot;
+}
+
+// Greedily place knots from the bottom of the domain to the top, making each segment as long as the budget allows. For a
+// segment's error that only grows with its length (true for any function whose second derivative doesn't change sign within
+// a segment), no placement with the knots on the curve needs fewer. Returns an error if the budget is too tight for the data
+// type (the next knot would round back down onto the last one).
+//
+static errno_t placeKnots(table_t * p_table, double budget)
+{
+	knot_t knot0 = makeKnot( options.domain_min ), last = makeKnot( options.domain_max );
+
+	p_table->size = 0;
+	addKnot( p_table, knot0 );
+
+	while( knot0.x < last.x )
+	{
+		knot_t knot1 = last;
+
+		if( segmentError( p_table, knot0, last ) > budget )
+		{
+			double low = knot0.x, high = last.x;
+
+			for( int step = 0; step < BISECTION_STEPS; step++ )
+			{
+				double middle = 0.5 * ( low + high );
+				if( segmentError( p_table, knot0, makeKnot( middle ) ) <= budget ) low = middle;
+				else high = middle;
+			}
+
+			knot1 = makeKnot( low );
+			if( knot1.x <= knot0.x ) return -1;
+		}
+
+		addKnot( p_table, knot1 );
+		knot0 = knot1;
+	}
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Minimax knot placement
+// ---------------------------------------------------------------------------------------------------------------------------
+//
+// With the knots on the curve, every segment's secant lies entirely to one side of the function (where f'' doesn't change
+// sign), so only half of the budget is ever used: the error runs from 0 at the knots to "budget" at the sag in between. Moving
+// the knots off the curve lets each segment's line cut through the function instead, with its error swinging from -budget to
+// +budget, so that segments can be up to about sqrt(2) times as long. The knots' y-values can't be picked one segment at a
+// time, though, since each knot is shared by two segments. Instead, the placement carries along every y-value the next knot
+// could take: at each knot, the lines that could start there (pairs of y0 and slope) and stay within the budget are a convex
+// polygon, found by cutting the lines that would be too far from the function at each sample point away from the range of
+// y0's the last segment could end on. The segment is made as long as it can be while that polygon isn't empty, and the range
+// of y-values its lines reach at the far end is what the next segment can start from. Once the top of the domain is reached,
+// a second pass walks back down picking a y-value at each knot that's consistent with the knot after it.
+//
+// That gives the smallest number of knots for the budget (or very nearly; a longer segment could end on a narrower range of
+// y-values). The budget is then shrunk for as long as the knot count stays the same, which leaves every segment about as close
+// to its limit as the others (the peak errors equalize) and the table with as much margin under the budget as possible.
+
+typedef struct line_t
+{
+	double y0;
+	double slope;
+} line_t;
+
+typedef struct range_t
+{
+	double low;
+	double high;
+} range_t;
+
+// A range of y-values, limited to those a fixed-point output can hold (a knot past them would saturate)
+//
+static range_t representable(range_t range)
+{
+	if( options.type == TYPE_FIXED )
+	{
+		range.low = fmax( range.low, -ldexp( 1.0, options.yFormat.integerBits ) );
+		range.high = fmin( range.high, ldexp( 1.0, options.yFormat.integerBits ) - ldexp( 1.0, -options.yFormat.fractionBits ) );
+	}
+
+	return range;
+}
+
+// Cut away the lines for which "sign * ( y0 + slope * offset )" is more than "sign * limit", from the polygon in "p_in"
+// (Sutherland-Hodgman clipping against a half-plane). Returns the number of vertices left in "p_out".
+//
+static size_t clipLines(const line_t * p_in, size_t size, line_t * p_out, double offset, double limit, double sign)
+{
+	size_t ret = 0;
+
+	for( size_t idx = 0; idx < size; idx++ )
+	{
+		line_t current = p_in[idx], next = p_in[( idx + 1 ) % size];
+		double currentExcess = sign * ( current.y0 + ( current.slope * offset ) - limit );
+		double nextExcess = sign * ( next.y0 + ( next.slope * offset ) - limit );
+
+		if( currentExcess <= 0.0 ) p_out[ret++] = current;
+		if( ( currentExcess <= 0.0 ) != ( nextExcess <= 0.0 ) )
+		{
+			double t = currentExcess / ( currentExcess - nextExcess );
+			p_out[ret++] = (line_t){ current.y0 + ( t * ( next.y0 - current.y0 ) ), current.slope + ( t * ( next.slope - current.slope ) ) };
+		}
+	}
+
+	return ret;
+}
+
+// The points a segment from x0 to x1 is checked at: evenly spaced along it or, for a function given as samples, each sample
+// inside it (the error is largest at one of them); either way, x1 itself is last. Returns the number of points.
+//
+static double * p_checkpoints;
+static size_t checkpoints_capacity;
+
+static size_t segmentCheckpoints(double x0, double x1)
+{
+	size_t ret = 0, needed = SEGMENT_SAMPLES;
+
+	if( options.p_function == NULL ) needed = samples.size + 1;
+	if( needed > checkpoints_capacity )
+	{
+		checkpoints_capacity = needed;
+		p_checkpoints = (double *)realloc( p_checkpoints, checkpoints_capacity * sizeof( double ) );
+		ASSERT( p_checkpoints != NULL );
+	}
+
+	if( options.p_function != NULL )
+	{
+		for( int idx = 1; idx < SEGMENT_SAMPLES; idx++ ) p_checkpoints[ret++] = x0 + ( ( x1 - x0 ) * idx / SEGMENT_SAMPLES );
+	}
+	else
+	{
+		for( size_t idx = samples_segment( x0 ); ( idx < samples.size ) && ( samples.x[idx] < x1 ); idx++ )
+		{
+			if( samples.x[idx] > x0 ) p_checkpoints[ret++] = samples.x[idx];
+		}
+	}
+	p_checkpoints[ret++] = x1;
+
+	return ret;
+}
+
+// The lines that start from "start" at x0 and stay within "budget" of the function all the way to x1. Returns the number of
+// vertices of the polygon they make up (0 if there aren't any), which is left in "*pp_lines".
+//
+static size_t feasibleLines(double x0, range_t start, double x1, double budget, const line_t ** pp_lines)
+{
+	static line_t * p_buffers[2];
+	static size_t buffers_capacity;
+
+	size_t points = segmentCheckpoints( x0, x1 ), size = 4;
+	double span = x1 - x0, y1 = f( x1 );
+
+	// Every clip adds at most one vertex
+	//
+	if( ( 4 + ( 2 * points ) ) > buffers_capacity )
+	{
+		buffers_capacity = 4 + ( 2 * points );
+		for( int idx = 0; idx < 2; idx++ )
+		{
+			p_buffers[idx] = (line_t *)realloc( p_buffers[idx], buffers_capacity * sizeof( line_t ) );
+			ASSERT( p_buffers[idx] != NULL );
+		}
+	}
+
+	// Start from the lines that begin in "start" and end within the budget at x1 (which bounds their slopes), then cut away
+	// those that stray too far anywhere in between
+	//
+	double slope_min = ( y1 - budget - start.high ) / span, slope_max = ( y1 + budget - start.low ) / span;
+	line_t * p_in = p_buffers[0], * p_out = p_buffers[1];
+
+	p_in[0] = (line_t){ start.low, slope_min };
+	p_in[1] = (line_t){ start.high, slope_min };
+	p_in[2] = (line_t){ start.high, slope_max };
+	p_in[3] = (line_t){ start.low, slope_max };
+
+	for( size_t idx = 0; ( idx < points ) && ( size > 0 ); idx++ )
+	{
+		double offset = p_checkpoints[idx] - x0, y = f( p_checkpoints[idx] );
+
+		size = clipLines( p_in, size, p_out, offset, y + budget, 1.0 );
+		size = clipLines( p_out, size, p_in, offset, y - budget, -1.0 );
+	}
+
+	// And those that would end on a value the output can't hold
+	//
+	range_t limits = representable( (range_t){ -INFINITY, INFINITY } );
+
+	if( ( size > 0 ) && isfinite( limits.high ) )
+	{
+		size = clipLines( p_in, size, p_out, span, limits.high, 1.0 );
+		size = clipLines( p_out, size, p_in, span, limits.low, -1.0 );
+	}
+
+	*pp_lines = p_in;
+
+	return size;
+}
+
+// Returns an error if the budget is too tight for the data type, or needs more than "maxKnots" knots
+//
+static errno_t placeKnots_minimaxGreedy(table_t * p_table, range_t ** pp_ranges, size_t * p_rangesCapacity, double budget, size_t maxKnots)
+{
+	const line_t * p_lines;
+	double x0 = roundX( options.domain_min ), last = roundX( options.domain_max );
+	range_t start = representable( (range_t){ f( x0 ) - budget, f( x0 ) + budget } );
+
+	p_table->size = 0;
+
+	while( 1 )
+	{
+		if( p_table->size == *p_rangesCapacity )
+		{
+			*p_rangesCapacity = ( *p_rangesCapacity == 0 ) ? 64 : ( *p_rangesCapacity * 2 );
+			*pp_ranges = (range_t *)realloc( *pp_ranges, *p_rangesCapacity * sizeof( range_t ) );
+			ASSERT( *pp_ranges != NULL );
+		}
+		( *pp_ranges )[p_table->size] = start;
+		addKnot( p_table, (knot_t){ x0, 0.0 } );
+
+		if( x0 >= last ) break;
+		if( p_table->size == maxKnots ) return -1;
+
+		double x1 = last;
+		size_t size = feasibleLines( x0, start, last, budget, &p_lines );
+
+		if( size == 0 )
+		{
+			double low = x0, high = last;
+
+			for( int step = 0; step < BISECTION_STEPS; step++ )
+			{
+				double middle = 0.5 * ( low + high );
+				if( feasibleLines( x0, start, roundX( middle ), budget, &p_lines ) > 0 ) low = middle;
+				else high = middle;
+			}
+
+			x1 = roundX( low );
+			if( x1 <= x0 ) return -1;
+			size = feasibleLines( x0, start, x1, budget, &p_lines );
+			if( size == 0 ) return -1;
+		}
+
+		// The y-values the lines reach at x1
+		//
+		start = (range_t){ INFINITY, -INFINITY };
+		for( size_t idx = 0; idx < size; idx++ )
+		{
+			double y1 = p_lines[idx].y0 + ( p_lines[idx].slope * ( x1 - x0 ) );
+			start.low = fmin( start.low, y1 );
+			start.high = fmax( start.high, y1 );
+		}
+		x0 = x1;
+	}
+
+	// Walk back down: the last knot takes the middle of its range and each knot before it the y-value in the middle of those
+	// that keep the segment after it within the budget
+	//
+	range_t * p_ranges = *pp_ranges;
+	size_t top = p_table->size - 1;
+
+	p_table->knots[top].y = 0.5 * ( p_ranges[top].low + p_ranges[top].high );
+
+	for( size_t idx = top; idx-- > 0; )
+	{
+		double xA = p_table->knots[idx].x, xB = p_table->knots[idx+1].x, yB = p_table->knots[idx+1].y, span = xB - xA;
+		range_t slopes = { ( yB - p_ranges[idx].high ) / span, ( yB - p_ranges[idx].low ) / span };
+		size_t points = segmentCheckpoints( xA, xB );
+
+		// The line through ( xB, yB ) with slope s is at yB - s * ( xB - x ) at x
+		//
+		for( size_t point = 0; point + 1 < points; point++ )
+		{
+			double distance = xB - p_checkpoints[point], y = f( p_checkpoints[point] );
+			slopes.low = fmax( slopes.low, ( yB - y - budget ) / distance );
+			slopes.high = fmin( slopes.high, ( yB - y + budget ) / distance );
+		}
+
+		p_table->knots[idx].y = yB - ( 0.5 * ( slopes.low + slopes.high ) * span );
+	}
+
+	for( size_t idx = 0; idx < p_table->size; idx++ ) p_table->knots[idx].y = roundY( p_table->knots[idx].y );
+
+	return 0;
+}
+
+// Place the fewest knots that meet "budget", then shrink the budget (by bisection) to the smallest that still only needs that
+// many
+//
+static errno_t placeKnots_minimax(table_t * p_table, double budget)
+{
+	static range_t * p_ranges;
+	static size_t ranges_capacity;
+
+	if( placeKnots_minimaxGreedy( p_table, &p_ranges, &ranges_capacity, budget, SIZE_MAX ) != 0 ) return -1;
+
+	size_t knots = p_table->size;
+	double low = 0.0, high = budget;
+
+	for( int step = 0; step < EQUALIZING_STEPS; step++ )
+	{
+		double middle = 0.5 * ( low + high );
+
+		if( placeKnots_minimaxGreedy( p_table, &p_ranges, &ranges_capacity, middle, knots ) == 0 ) high = middle;
+		else low = middle;
+	}
+
+	return placeKnots_minimaxGreedy( p_table, &p_ranges, &ranges_capacity, high, knots );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Checking the finished table
+// ---------------------------------------------------------------------------------------------------------------------------
+
+// The look-up the generated code does, for an input that's already in the table's data type
+//
+static double evaluate(const table_t * p_table, size_t idx, double x)
+{
+	const knot_t * p_knot = &p_table->knots[idx];
+	double slope = roundSlope( p_table, ( p_knot[1].y - p_knot[0].y ) / ( p_knot[1].x - p_knot[0].x ) );
+	double ret;
+
+	if( options.type == TYPE_DOUBLE ) ret = p_knot->y + ( slope * ( x - p_knot->x ) );
+	else if( options.type == TYPE_FLOAT ) ret = (float)( (float) p_knot->y + ( (float) slope * ( (float) x - (float) p_knot->x ) ) );
+	else
+	{
+		int shift = p_table->slopeFractionBits + options.xFormat.fractionBits - options.yFormat.fractionBits;
+		int64_t span = (int64_t) toFixed( x, options.xFormat.fractionBits ) - (int64_t) toFixed( p_knot->x, options.xFormat.fractionBits );
+		int64_t offset = ( (int64_t) toFixed( slope, p_table->slopeFractionBits ) * span ) >> shift;
+
+		ret = fromFixed( (double)( (int32_t) toFixed( p_knot->y, options.yFormat.fractionBits ) + (int32_t) offset ), options.yFormat.fractionBits );
+	}
+
+	return ret;
+}
+
+// The largest error of the table over the domain, and the input it's at
+//
+static double tableError(const table_t * p_table, double * p_worst)
+{
+	double ret = 0.0;
+
+	*p_worst = options.domain_min;
+
+	for( size_t idx = 0; idx + 1 < p_table->size; idx++ )
+	{
+		double x0 = p_table->knots[idx].x, x1 = p_table->knots[idx+1].x;
+
+		for( int sample = 0; sample <= VERIFY_SAMPLES; sample++ )
+		{
+			double x = roundX( x0 + ( ( x1 - x0 ) * sample / VERIFY_SAMPLES ) );
+			if( x < x0 ) x = x0;
+
+			double error = fabs( f( x ) - evaluate( p_table, idx, x ) );
+			if( error > ret )
+			{
+				ret = error;
+				*p_worst = x;
+			}
+		}
+	}
+
+	return ret;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Writing the table out
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static const char * typeName(void)
+{
+	return ( options.type == TYPE_DOUBLE ) ? "double" : ( options.type == TYPE_FLOAT ) ? "float" : "int32_t";
+}
+
+static void printValue(FILE * p_stream, double value, int fractionBits)
+{
+	if( options.type == TYPE_DOUBLE ) fprintf( p_stream, "%.17g", value );
+	else if( options.type == TYPE_FLOAT ) fprintf( p_stream, "%#.9gf", value );
+	else fprintf( p_stream, "%ld", (long) toFixed( value, fractionBits ) );
+}
+
+static void upperCase(char * p_out, const char * p_in, size_t size)
+{
+	size_t idx = 0;
+
+	for( ; ( p_in[idx] != '\0' ) && ( idx + 1 < size ); idx++ )
+	{
+		char c = p_in[idx];
+		p_out[idx] = ( ( c >= 'a' ) && ( c <= 'z' ) ) ? (char)( c - 'a' + 'A' ) : c;
+	}
+	p_out[idx] = '\0';
+}
+
+static void printDescription(FILE * p_stream, const table_t * p_table, double measuredError, const char * commandLine)
+{
+	fprintf( p_stream, "// Generated by tools/table-compiler.c; don't edit. %s over [%.17g, %.17g], %zu knots, max error %g (measured %g).\n",
+		( options.p_function != NULL ) ? options.p_function->name : options.sampleFile, options.domain_min, options.domain_max,
+		p_table->size, options.maxError, measuredError );
+	fprintf( p_stream, "// %s\n//\n", commandLine );
+}
+
+static errno_t writeHeader(const table_t * p_table, double measuredError, const char * commandLine)
+{
+	char fileName[256], guard[256];
+	const char * name = options.name;
+
+	snprintf( fileName, sizeof( fileName ), "%s.h", name );
+	upperCase( guard, name, sizeof( guard ) );
+
+	FILE * p_stream = fopen( fileName, "w" );
+	if( p_stream == NULL ) return -1;
+
+	printDescription( p_stream, p_table, measuredError, commandLine );
+	fprintf( p_stream, "#ifndef %s_H\n#define %s_H\n\n#include <stdint.h>\n\n", guard, guard );
+	fprintf( p_stream, "#define %s_SIZE %zu\n", guard, p_table->size );
+	fprintf( p_stream, "#define %s_MAX_ERROR %.17g\n", guard, options.maxError );
+	if( options.type == TYPE_FIXED )
+	{
+		fprintf( p_stream, "\n// x0 is a q%d.%d, y0 a q%d.%d and the slope a q%d.%d\n", options.xFormat.integerBits, options.xFormat.fractionBits,
+			options.yFormat.integerBits, options.yFormat.fractionBits, 31 - p_table->slopeFractionBits, p_table->slopeFractionBits );
+		fprintf( p_stream, "#define %s_X_FRACTION_BITS %d\n", guard, options.xFormat.fractionBits );
+		fprintf( p_stream, "#define %s_Y_FRACTION_BITS %d\n", guard, options.yFormat.fractionBits );
+		fprintf( p_stream, "#define %s_SLOPE_FRACTION_BITS %d\n", guard, p_table->slopeFractionBits );
+	}
+	fprintf( p_stream, "\n// Segment \"idx\" runs from x0 to the next segment's x0; the last segment only holds the top of the domain\n" );
+	fprintf( p_stream, "typedef struct %s_segment_t\n{\n\t%s x0;\n\t%s y0;\n\t%s slope;\n} %s_segment_t;\n\n", name, typeName(),
+		typeName(), typeName(), name );
+	fprintf( p_stream, "extern const %s_segment_t %s_table[%s_SIZE];\n\n", name, name, guard );
+	fprintf( p_stream, "// Look \"x\" up in the table. Inputs outside the domain are extrapolated from the first or last segment.\n" );
+	fprintf( p_stream, "%s %s(%s x);\n\n#endif // %s_H\n", typeName(), name, typeName(), guard );
+
+	fclose( p_stream );
+
+	return 0;
+}
+
+static errno_t writeSource(const table_t * p_table, double measuredError, const char * commandLine)
+{
+	char fileName[256], guard[256];
+	const char * name = options.name;
+
+	snprintf( fileName, sizeof( fileName ), "%s.c", name );
+	upperCase( guard, name, sizeof( guard ) );
+
+	FILE * p_stream = fopen( fileName, "w" );
+	if( p_stream == NULL ) return -1;
+
+	printDescription( p_stream, p_table, measuredError, commandLine );
+	fprintf( p_stream, "#include <stddef.h>\n#include \"%s.h\"\n\n", name );
+	fprintf( p_stream, "const %s_segment_t %s_table[%s_SIZE] =\n{\n", name, name, guard );
+
+	for( size_t idx = 0; idx < p_table->size; idx++ )
+	{
+		const knot_t * p_knot = &p_table->knots[idx];
+		double slope = ( idx + 1 < p_table->size ) ? roundSlope( p_table, ( p_knot[1].y - p_knot[0].y ) / ( p_knot[1].x - p_knot[0].x ) ) : 0.0;
+
+		fprintf( p_stream, "\t{ " );
+		printValue( p_stream, p_knot->x, options.xFormat.fractionBits );
+		fprintf( p_stream, ", " );
+		printValue( p_stream, p_knot->y, options.yFormat.fractionBits );
+		fprintf( p_stream, ", " );
+		printValue( p_stream, slope, p_table->slopeFractionBits );
+		fprintf( p_stream, " },%s", ( options.type == TYPE_FIXED ) ? "" : "\n" );
+		if( options.type == TYPE_FIXED ) fprintf( p_stream, "\t// { %.9g, %.9g, %.9g }\n", p_knot->x, p_knot->y, slope );
+	}
+
+	// The search is the branch-free one from include/nonuniform_lut.h, over every knot but the last (which only ends the last
+	// segment)
+	//
+	fprintf( p_stream, "};\n\n%s %s(%s x)\n{\n", typeName(), name, typeName() );
+	fprintf( p_stream, "\tconst %s_segment_t * p_segment = %s_table;\n\tsize_t size = %s_SIZE - 1;\n\n", name, name, guard );
+	fprintf( p_stream, "\twhile( size > 1 )\n\t{\n\t\tsize_t half = size / 2;\n" );
+	fprintf( p_stream, "\t\tp_segment = ( p_segment[half].x0 <= x ) ? ( p_segment + half ) : p_segment;\n\t\tsize -= half;\n\t}\n\n" );
+	if( options.type == TYPE_FIXED )
+	{
+		fprintf( p_stream, "\tint64_t offset = ( (int64_t) p_segment->slope * (int64_t)( x - p_segment->x0 ) ) >> %d;\n\n",
+			p_table->slopeFractionBits + options.xFormat.fractionBits - options.yFormat.fractionBits );
+		fprintf( p_stream, "\treturn p_segment->y0 + (int32_t) offset;\n}\n" );
+	}
+	else fprintf( p_stream, "\treturn p_segment->y0 + ( p_segment->slope * ( x - p_segment->x0 ) );\n}\n" );
+
+	fclose( p_stream );
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Command line
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static void printUsage(const char * program)
+{
+	fprintf(stderr, "Usage: %s (--function=NAME | --samples=FILE) --domain=MIN:MAX --max-error=ERROR\n", program);
+	fprintf(stderr, "       [--type=double|float|qI.F] [--input-type=qI.F] [--name=NAME] [--minimax]\n");
+	fprintf(stderr, "  --function    The function to tabulate; one of:\n               ");
+	for( size_t idx = 0; idx < NUM_FUNCTIONS; idx++ ) fprintf(stderr, " %s", functions[idx].name);
+	fprintf(stderr, "\n  --samples     Tabulate a function given as \"x y\" pairs, one per line, in increasing order of x (lines\n");
+	fprintf(stderr, "                starting with '#' are skipped); it's taken to be linear between them\n");
+	fprintf(stderr, "  --domain      The inputs the table covers, [MIN, MAX]\n");
+	fprintf(stderr, "  --max-error   The largest absolute error allowed anywhere in the domain\n");
+	fprintf(stderr, "  --type        The table's data type (default: double). A fixed-point qI.F is a signed 32-bit integer with\n");
+	fprintf(stderr, "                I integer and F fractional bits; this is the format of the outputs\n");
+	fprintf(stderr, "  --input-type  With a fixed-point --type, the format of the inputs (default: q9.22)\n");
+	fprintf(stderr, "  --name        The name of the table and its look-up function; the files written are NAME.h and NAME.c\n");
+	fprintf(stderr, "                (default: the function's name followed by \"_lut\")\n");
+	fprintf(stderr, "  --minimax     Let the knots' values move off the curve, spreading each segment's error to both sides of\n");
+	fprintf(stderr, "                the function, so that fewer knots are needed\n");
+}
+
+static int parseQFormat(const char * text, qFormat_t * p_format)
+{
+	char * end;
+
+	if( text[0] != 'q' ) return -1;
+	p_format->integerBits = (int) strtol( text + 1, &end, 10 );
+	if( *end != '.' ) return -1;
+	p_format->fractionBits = (int) strtol( end + 1, &end, 10 );
+	if( *end != '\0' ) return -1;
+
+	return ( ( p_format->integerBits >= 0 ) && ( p_format->fractionBits >= 0 ) &&
+		( p_format->integerBits + p_format->fractionBits <= 31 ) ) ? 0 : -1;
+}
+
+static int parseOptions(int argc, char * argv[])
+{
+	static char defaultName[64];
+	int domainGiven = 0;
+
+	options.type = TYPE_DOUBLE;
+	options.xFormat = (qFormat_t){ 9, 22 };
+	options.maxError = NAN;
+
+	for( int idx = 1; idx < argc; idx++ )
+	{
+		const char * arg = argv[idx];
+		char * end;
+
+		if( strncmp( arg, "--function=", strlen( "--function=" ) ) == 0 )
+		{
+			for( size_t fcn = 0; fcn < NUM_FUNCTIONS; fcn++ )
+			{
+				if( strcmp( arg + strlen( "--function=" ), functions[fcn].name ) == 0 ) options.p_function = &functions[fcn];
+			}
+			if( options.p_function == NULL ) return -1;
+		}
+		else if( strncmp( arg, "--samples=", strlen( "--samples=" ) ) == 0 ) options.sampleFile = arg + strlen( "--samples=" );
+		else if( strncmp( arg, "--domain=", strlen( "--domain=" ) ) == 0 )
+		{
+			options.domain_min = strtod( arg + strlen( "--domain=" ), &end );
+			if( *end != ':' ) return -1;
+			options.domain_max = strtod( end + 1, &end );
+			if( *end != '\0' ) return -1;
+			domainGiven = 1;
+		}
+		else if( strncmp( arg, "--max-error=", strlen( "--max-error=" ) ) == 0 )
+		{
+			options.maxError = strtod( arg + strlen( "--max-error=" ), &end );
+			if( ( *end != '\0' ) || !( options.maxError > 0.0 ) ) return -1;
+		}
+		else if( strcmp( arg, "--type=double" ) == 0 ) options.type = TYPE_DOUBLE;
+		else if( strcmp( arg, "--type=float" ) == 0 ) options.type = TYPE_FLOAT;
+		else if( strncmp( arg, "--type=", strlen( "--type=" ) ) == 0 )
+		{
+			if( parseQFormat( arg + strlen( "--type=" ), &options.yFormat ) != 0 ) return -1;
+			options.type = TYPE_FIXED;
+		}
+		else if( strncmp( arg, "--input-type=", strlen( "--input-type=" ) ) == 0 )
+		{
+			if( parseQFormat( arg + strlen( "--input-type=" ), &options.xFormat ) != 0 ) return -1;
+		}
+		else if( strncmp( arg, "--name=", strlen( "--name=" ) ) == 0 ) options.name = arg + strlen( "--name=" );
+		else if( strcmp( arg, "--minimax" ) == 0 ) options.minimax = 1;
+		else return -1;
+	}
+
+	// Exactly one function, and a domain and budget that make sense
+	//
+	if( ( options.p_function == NULL ) == ( options.sampleFile == NULL ) ) return -1;
+	if( !domainGiven || !isfinite( options.domain_min ) || !isfinite( options.domain_max ) ) return -1;
+	if( options.domain_min >= options.domain_max ) return -1;
+	if( isnan( options.maxError ) ) return -1;
+
+	if( options.name == NULL )
+	{
+		snprintf( defaultName, sizeof( defaultName ), "%s_lut", ( options.p_function != NULL ) ? options.p_function->name : "samples" );
+		options.name = defaultName;
+	}
+
+	return 0;
+}
+
+int main(int argc, char * argv[])
+{
+	char commandLine[1024] = "Command:";
+	table_t table = { 0 };
+
+	if( parseOptions( argc, argv ) != 0 )
+	{
+		printUsage( ( argc > 0 ) ? argv[0] : "table-compiler" );
+		return EXIT_FAILURE;
+	}
+
+	for( int idx = 1; idx < argc; idx++ )
+	{
+		strncat( commandLine, " ", sizeof( commandLine ) - strlen( commandLine ) - 1 );
+		strncat( commandLine, argv[idx], sizeof( commandLine ) - strlen( commandLine ) - 1 );
+	}
+
+	if( ( options.sampleFile != NULL ) && ( readSamples( options.sampleFile ) != 0 ) )
+	{
+		fprintf(stderr, "ERROR: Couldn't read samples from \"%s\"\n", options.sampleFile);
+		return EXIT_FAILURE;
+	}
+
+	// Check that the function can be evaluated everywhere in the domain, and find how large it (and its slope) gets, for the
+	// fixed-point formats
+	//
+	double maxValue = 0.0, maxSlope = 0.0, previous = f( options.domain_min );
+	for( int idx = 0; idx <= VERIFY_SAMPLES; idx++ )
+	{
+		double x = options.domain_min + ( ( options.domain_max - options.domain_min ) * idx / VERIFY_SAMPLES );
+		double value = f( x );
+
+		if( !isfinite( value ) )
+		{
+			fprintf(stderr, "ERROR: The function isn't finite at %.17g\n", x);
+			return EXIT_FAILURE;
+		}
+		if( fabs( value ) > maxValue ) maxValue = fabs( value );
+		if( idx > 0 )
+		{
+			double slope = fabs( value - previous ) / ( ( options.domain_max - options.domain_min ) / VERIFY_SAMPLES );
+			if( slope > maxSlope ) maxSlope = slope;
+		}
+		previous = value;
+	}
+
+	// The slopes get as many fractional bits as they can while still holding twice the steepest slope sampled (a segment's
+	// slope is an average, so it can't be steeper than the function, but the sampling could miss the steepest part)
+	//
+	if( options.type == TYPE_FIXED )
+	{
+		int slopeIntegerBits = 0;
+
+		while( ( slopeIntegerBits < 31 ) && ( ldexp( 1.0, slopeIntegerBits ) <= 2.0 * maxSlope ) ) slopeIntegerBits++;
+		table.slopeFractionBits = 31 - slopeIntegerBits;
+
+		if( !fitsFixed( options.domain_min, options.xFormat ) || !fitsFixed( options.domain_max, options.xFormat ) ||
+			( maxValue > ldexp( 1.0, options.yFormat.integerBits ) ) )
+		{
+			fprintf(stderr, "ERROR: The domain or the function's values don't fit in the fixed-point formats\n");
+			return EXIT_FAILURE;
+		}
+		if( table.slopeFractionBits + options.xFormat.fractionBits < options.yFormat.fractionBits )
+		{
+			fprintf(stderr, "ERROR: The function is too steep for the output's fixed-point format\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Leave room in the budget for the look-up's own rounding, then tighten it for as long as the finished table comes out over
+	//
+	double budget = options.maxError, measuredError = INFINITY, worst = 0.0;
+
+	if( options.type == TYPE_FLOAT ) budget -= 2.0 * ( nextafterf( (float) maxValue, INFINITY ) - (float) maxValue );
+	else if( options.type == TYPE_FIXED ) budget -= 1.5 * ldexp( 1.0, -options.yFormat.fractionBits );
+
+	for( int attempt = 0; ( attempt < MAX_ATTEMPTS ) && ( budget > 0.0 ); attempt++ )
+	{
+		if( ( options.minimax ? placeKnots_minimax( &table, budget ) : placeKnots( &table, budget ) ) != 0 ) break;
+
+		measuredError = tableError( &table, &worst );
+		if( measuredError <= options.maxError ) break;
+
+		budget -= ( measuredError - options.maxError ) + ( 0.01 * options.maxError );
+	}
+
+	if( !( measuredError <= options.maxError ) )
+	{
+		fprintf(stderr, "ERROR: Couldn't meet a max error of %g with this data type\n", options.maxError);
+		return EXIT_FAILURE;
+	}
+
+	if( ( writeHeader( &table, measuredError, commandLine ) != 0 ) || ( writeSource( &table, measuredError, commandLine ) != 0 ) )
+	{
+		fprintf(stderr, "ERROR: Couldn't write %s.h and %s.c\n", options.name, options.name);
+		return EXIT_FAILURE;
+	}
+
+	size_t valueBytes = ( options.type == TYPE_DOUBLE ) ? sizeof( double ) : ( options.type == TYPE_FLOAT ) ? sizeof( float ) : sizeof( int32_t );
+	printf("%zu knots (%zu bytes), max error %g at %.17g\nWrote %s.h and %s.c\n", table.size, table.size * 3 * valueBytes,
+		measuredError, worst, options.name, options.name);
+
+	free( table.knots );
+	free( samples.x );
+	free( samples.y );
+
+	return EXIT_SUCCESS;
+}